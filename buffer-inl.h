@@ -18,19 +18,42 @@ namespace OGLWRAP_NAMESPACE_NAME {
 template<BufferType BUFFER_TYPE>
 void BufferObject<BUFFER_TYPE>::data(GLsizei size, const void* data,
                                      BufferUsage usage) {
+#if OGLWRAP_USE_DSA
+  gl(NamedBufferData(buffer_, size, data, GLenum(usage)));
+#else
   OGLWRAP_CHECK_BINDING();
 
   gl(BufferData(GLenum(BUFFER_TYPE), size, data, GLenum(usage)));
+#endif
 }
 
 template<BufferType BUFFER_TYPE>
 template<typename GLtype>
 void BufferObject<BUFFER_TYPE>::data(
     const std::vector<GLtype>& data, BufferUsage usage) {
+#if OGLWRAP_USE_DSA
+  gl(NamedBufferData(buffer_, data.size() * sizeof(GLtype),
+                     data.data(), GLenum(usage)));
+#else
   OGLWRAP_CHECK_BINDING();
 
   gl(BufferData(GLenum(BUFFER_TYPE), data.size() * sizeof(GLtype),
                 data.data(), GLenum(usage)));
+#endif
+}
+#endif
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glBufferStorage)
+template<BufferType BUFFER_TYPE>
+void BufferObject<BUFFER_TYPE>::storage(GLsizeiptr size, const void* data,
+                                        Bitfield<BufferMapAccessFlags> flags) {
+#if OGLWRAP_USE_DSA
+  gl(NamedBufferStorage(buffer_, size, data, flags));
+#else
+  OGLWRAP_CHECK_BINDING();
+
+  gl(BufferStorage(GLenum(BUFFER_TYPE), size, data, flags));
+#endif
 }
 #endif
 
@@ -39,19 +62,28 @@ template<BufferType BUFFER_TYPE>
 template<typename GLtype>
 void BufferObject<BUFFER_TYPE>::subData(GLintptr offset, GLsizei size,
                                         const GLtype* data) {
+#if OGLWRAP_USE_DSA
+  gl(NamedBufferSubData(buffer_, offset, size, data));
+#else
   OGLWRAP_CHECK_BINDING();
 
   gl(BufferSubData(GLenum(BUFFER_TYPE), offset, size, data));
+#endif
 }
 
 template<BufferType BUFFER_TYPE>
 template<typename GLtype>
 void BufferObject<BUFFER_TYPE>::subData(GLintptr offset,
                                         const std::vector<GLtype>& data) {
+#if OGLWRAP_USE_DSA
+  gl(NamedBufferSubData(buffer_, offset,
+                        data.size() * sizeof(GLtype), data.data()));
+#else
   OGLWRAP_CHECK_BINDING();
 
   gl(BufferSubData(GLenum(BUFFER_TYPE), offset,
                    data.size() * sizeof(GLtype), data.data()));
+#endif
 }
 #endif
 
@@ -59,9 +91,13 @@ void BufferObject<BUFFER_TYPE>::subData(GLintptr offset,
     || (defined(glGetBufferParameteriv) && defined(GL_BUFFER_SIZE))
   template<BufferType BUFFER_TYPE>
   size_t BufferObject<BUFFER_TYPE>::size() const {
-    OGLWRAP_CHECK_BINDING();
     GLint size;
+  #if OGLWRAP_USE_DSA
+    gl(GetNamedBufferParameteriv(buffer_, GL_BUFFER_SIZE, &size));
+  #else
+    OGLWRAP_CHECK_BINDING();
     gl(GetBufferParameteriv(GLenum(BUFFER_TYPE), GL_BUFFER_SIZE, &size));
+  #endif
     return size;
   }
 #endif  // glGetBufferParameteriv && GL_BUFFER_SIZE
@@ -86,9 +122,40 @@ BufferObject<BUFFER_TYPE>::TypedMap<T>::TypedMap(
   gl(GetBufferParameteriv(GLenum(BUFFER_TYPE), GL_BUFFER_SIZE, (GLint*)&size_));
 }
 
+#if OGLWRAP_USE_DSA
+template<BufferType BUFFER_TYPE>
+template <class T>
+BufferObject<BUFFER_TYPE>::TypedMap<T>::TypedMap(const BufferObject& buffer,
+                                                 BufferMapAccess access)
+    : buffer_(buffer.expose()) {
+  data_ = gl(MapNamedBuffer(buffer_, GLenum(access)));
+  GLint size;
+  gl(GetNamedBufferParameteriv(buffer_, GL_BUFFER_SIZE, &size));
+  size_ = size;
+}
+
+template<BufferType BUFFER_TYPE>
+template <class T>
+BufferObject<BUFFER_TYPE>::TypedMap<T>::TypedMap(
+    const BufferObject& buffer, GLintptr offset, GLsizeiptr length,
+    Bitfield<BufferMapAccessFlags> access)
+    : buffer_(buffer.expose()) {
+  data_ = gl(MapNamedBufferRange(buffer_, offset, length, access));
+  GLint size;
+  gl(GetNamedBufferParameteriv(buffer_, GL_BUFFER_SIZE, &size));
+  size_ = size;
+}
+#endif
+
 template<BufferType BUFFER_TYPE>
 template <class T>
 BufferObject<BUFFER_TYPE>::TypedMap<T>::~TypedMap() {
+#if OGLWRAP_USE_DSA
+  if (buffer_ != 0) {
+    gl(UnmapNamedBuffer(buffer_));
+    return;
+  }
+#endif
   OGLWRAP_CHECK_FOR_DEFAULT_BINDING(GLenum(GetBindingTarget(BUFFER_TYPE)));
   gl(UnmapBuffer(GLenum(BUFFER_TYPE)));
 }
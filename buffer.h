@@ -70,6 +70,21 @@ class BufferObject {
             BufferUsage usage = BufferUsage::kStaticDraw);
 #endif  // glBufferData
 
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glBufferStorage)
+  /// Creates an immutable data store for the buffer object.
+  /** @param size    Specifies the size in bytes of the buffer object's new data
+    *                store.
+    * @param data    Specifies a pointer to data that will be copied into the
+    *                data store for initialization, or NULL if no data is to be
+    *                copied.
+    * @param flags   Specifies the intended usage of the buffer's data store
+    *                (like kMapWriteBit, kMapPersistentBit, kMapCoherentBit).
+    * @see glBufferStorage
+    * @version OpenGL 4.4 */
+  void storage(GLsizeiptr size, const void* data,
+               Bitfield<BufferMapAccessFlags> flags);
+#endif  // glBufferStorage
+
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBufferSubData)
   template<typename GLtype>
   /// Updates a subset of a buffer object's data store.
@@ -130,6 +145,28 @@ class BufferObject {
               {BufferMapAccessFlags::kMapReadBit,
                BufferMapAccessFlags::kMapWriteBit});
 
+#if OGLWRAP_USE_DSA
+    /// Maps the whole of the given buffer, without binding it.
+    /** @param buffer  Specifies the buffer to map.
+      * @param access  Specifies the access policy (R, W, R/W).
+      * @see glMapNamedBuffer */
+    TypedMap(const BufferObject& buffer,
+             BufferMapAccess access = BufferMapAccess::kReadWrite);
+
+    /// Maps a range of the given buffer, without binding it.
+    /** @param buffer  Specifies the buffer to map.
+      * @param length  Specifies a length of the range to be mapped (in bytes).
+      * @param offset  Specifies a the starting offset within the buffer of the
+      *                range to be mapped (in bytes).
+      * @param access  Specifies a combination of access flags indicating the
+      *                desired access to the range.
+      * @see glMapNamedBufferRange */
+    TypedMap(const BufferObject& buffer, GLintptr offset, GLsizeiptr length,
+             Bitfield<BufferMapAccessFlags> access =
+              {BufferMapAccessFlags::kMapReadBit,
+               BufferMapAccessFlags::kMapWriteBit});
+#endif
+
     /// Unmaps the buffer.
     /** @see glUnmapBuffer */
     ~TypedMap();
@@ -149,6 +186,9 @@ class BufferObject {
    private:
     void *data_;  // The pointer to the data fetched from the buffer.
     size_t size_;  // The size of the data fetched from the buffer.
+  #if OGLWRAP_USE_DSA
+    GLuint buffer_ = 0;  // The mapped buffer, if it was mapped without binding.
+  #endif
   };
 
   using Map = TypedMap<GLubyte>;
@@ -67,6 +67,74 @@
   #endif
 #endif
 
+/**
+ * @brief If true, the object wrappers use direct state access (OpenGL 4.5 or
+ *        ARB_direct_state_access) instead of modifying the bound object.
+ *
+ * With this, the member functions of buffers, textures, framebuffers and
+ * renderbuffers don't require the object to be bound, so there is no need for
+ * binding them, and they are not bind-checked either. The few functions that
+ * don't have a DSA equivalent (like the mutable texture image uploads) still
+ * work on the bound object.
+ */
+#ifndef OGLWRAP_USE_DSA
+  #define OGLWRAP_USE_DSA 0
+#endif
+
+/**
+ * @brief If true, oglwrap keeps a client side copy of the bindings, that is
+ *        used to skip redundant binds, and to check bindings without glGet.
+ *
+ * If you modify the bindings without oglwrap (or switch between contexts), you
+ * have to call BindingCache::Invalidate() afterwards.
+ */
+#ifndef OGLWRAP_USE_BINDING_CACHE
+  #define OGLWRAP_USE_BINDING_CACHE 1
+#endif
+
+/**
+ * @brief If true, oglwrap keeps a client side copy of the fixed function
+ *        state (capabilities, blending, depth and stencil test, scissor box
+ *        and write masks), and skips the setter calls that wouldn't change it.
+ *
+ * If you modify these states without oglwrap (or switch between contexts), you
+ * have to call StateCache::Invalidate() afterwards.
+ */
+#ifndef OGLWRAP_USE_STATE_CACHE
+  #define OGLWRAP_USE_STATE_CACHE 1
+#endif
+
+/**
+ * @brief If true, oglwrap keeps a client side copy of the uniform values, the
+ *        Uniforms skip the uploads that wouldn't change the value, and get()
+ *        doesn't have to call glGetUniform*.
+ *
+ * If you set uniforms without oglwrap, you have to call
+ * UniformCache::Invalidate() afterwards.
+ */
+#ifndef OGLWRAP_USE_UNIFORM_CACHE
+  #define OGLWRAP_USE_UNIFORM_CACHE 0
+#endif
+
+/**
+ * @brief If true, the Uniforms are set with glProgramUniform* (OpenGL 4.1 or
+ *        ARB_separate_shader_objects), so their programs don't have to be in
+ *        use (and aren't bind-checked) when they are set.
+ */
+#ifndef OGLWRAP_USE_PROGRAM_UNIFORM
+  #define OGLWRAP_USE_PROGRAM_UNIFORM 0
+#endif
+
+/**
+ * @brief If true, the Programs enumerate their active uniforms, attributes,
+ *        uniform and storage blocks when they are linked, and the Uniforms and
+ *        VertexAttribs look their locations up from that table, instead of
+ *        querying them from the driver one by one.
+ */
+#ifndef OGLWRAP_USE_PROGRAM_REFLECTION
+  #define OGLWRAP_USE_PROGRAM_REFLECTION 0
+#endif
+
 /**
  * @brief If set to true, disables the oglwrap debug output.
  *
@@ -105,6 +173,47 @@
   #endif
 #endif
 
+/**
+ * @brief If true, oglwrap doesn't call glGetError after every gl call, it
+ *        only records the calls, and checks the errors in batches.
+ *
+ * glGetError is a synchronization point on many drivers, calling it after
+ * every call makes the debug build too slow for realistic scenes. With this,
+ * the errors are checked every OGLWRAP_ERROR_CHECK_INTERVAL calls, and when
+ * CheckErrors() is called (or an ErrorCheckScope ends), like at the end of a
+ * frame. An error is reported with the last OGLWRAP_CALL_HISTORY_SIZE calls,
+ * one of which caused it.
+ */
+#if OGLWRAP_DEBUG
+  #ifndef OGLWRAP_DEFERRED_ERROR_CHECKING
+    #define OGLWRAP_DEFERRED_ERROR_CHECKING 0
+  #endif
+
+  /// The number of calls after which the deferred errors are checked (0: never).
+  #ifndef OGLWRAP_ERROR_CHECK_INTERVAL
+    #define OGLWRAP_ERROR_CHECK_INTERVAL 256
+  #endif
+
+  /// The number of calls remembered for the deferred error checking.
+  #ifndef OGLWRAP_CALL_HISTORY_SIZE
+    #define OGLWRAP_CALL_HISTORY_SIZE 16
+  #endif
+#endif
+
+/**
+ * @brief If true, the errors are reported by the driver's debug output
+ *        (KHR_debug), instead of calling glGetError after the gl calls.
+ *
+ * This also reports the performance and other warnings of the driver. The
+ * callback has to be registered with DebugCallback::Enable(), after the
+ * context was created. Overrides OGLWRAP_DEFERRED_ERROR_CHECKING.
+ */
+#if OGLWRAP_DEBUG
+  #ifndef OGLWRAP_USE_DEBUG_CALLBACK
+    #define OGLWRAP_USE_DEBUG_CALLBACK 0
+  #endif
+#endif
+
 /**
  * @brief You can define a default shader path, like "shaders/"
  *
@@ -26,5 +26,7 @@
 #include "context/synchronization.h"
 #include "context/hints.h"
 #include "context/binding.h"
+#include "context/binding_cache.h"
+#include "context/state_cache.h"
 
 #endif  // OGLWRAP_CONTEXT_CAPABILITIES_H_
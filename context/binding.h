@@ -10,6 +10,8 @@
 #include "../vertex_array.h"
 #include "../textures/texture_base.h"
 #include "../program.h"
+#include "../program_pipeline.h"
+#include "./binding_cache.h"
 
 #include "../define_internal_macros.h"
 
@@ -19,249 +21,345 @@ namespace OGLWRAP_NAMESPACE_NAME {
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindBuffer)
 template<BufferType BUFFER_TYPE>
 void Bind(const BufferObject<BUFFER_TYPE>& buffer) {
-  gl(BindBuffer(GLenum(BUFFER_TYPE), buffer.expose()));
+  if (BindingCache::Update(BindingKind::kBuffer, GLenum(BUFFER_TYPE),
+                           buffer.expose())) {
+    gl(BindBuffer(GLenum(BUFFER_TYPE), buffer.expose()));
+  }
 }
 
-template<BufferType BUFFER_TYPE>
-void Unbind(const BufferObject<BUFFER_TYPE>&) {
-  gl(BindBuffer(GLenum(BUFFER_TYPE), 0));
+inline void Unbind(BufferType BUFFER_TYPE) {
+  if (BindingCache::Update(BindingKind::kBuffer, GLenum(BUFFER_TYPE), 0)) {
+    gl(BindBuffer(GLenum(BUFFER_TYPE), 0));
+  }
 }
 
-inline void Unbind(BufferType BUFFER_TYPE) {
-  gl(BindBuffer(GLenum(BUFFER_TYPE), 0));
+template<BufferType BUFFER_TYPE>
+void Unbind(const BufferObject<BUFFER_TYPE>&) {
+  Unbind(BUFFER_TYPE);
 }
 
 template<BufferType BUFFER_TYPE>
 bool IsBound(const BufferObject<BUFFER_TYPE>& buffer) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(BUFFER_TYPE)),
-                 &currently_bound_buffer));
-
-  return buffer.expose() == GLuint(currently_bound_buffer);
+  return buffer.expose() == BindingCache::Query(
+      BindingKind::kBuffer, GLenum(BUFFER_TYPE),
+      GLenum(GetBindingTarget(BUFFER_TYPE)));
 }
 
 template<BufferType BUFFER_TYPE>
 BufferObject<BUFFER_TYPE> GetCurrentlyBoundObject(const BufferObject<BUFFER_TYPE>*) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(BUFFER_TYPE)),
-                 &currently_bound_buffer));
-  return BufferObject<BUFFER_TYPE>{GLuint(currently_bound_buffer)};
+  return BufferObject<BUFFER_TYPE>{BindingCache::Query(
+      BindingKind::kBuffer, GLenum(BUFFER_TYPE),
+      GLenum(GetBindingTarget(BUFFER_TYPE)))};
 }
 #endif
 
 // IndexedBuffer
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindBufferBase)
+inline void OGLWRAP_bindBufferBase(IndexedBufferType buffer_type, GLuint index,
+                                   GLuint handle) {
+  // glBindBufferBase binds to the generic binding point too.
+  bool indexed_changed = BindingCache::Update(
+      BindingKind::kBuffer, GLenum(buffer_type), handle, index);
+  bool generic_changed = BindingCache::Update(
+      BindingKind::kBuffer, GLenum(buffer_type), handle);
+  if (indexed_changed || generic_changed) {
+    gl(BindBufferBase(GLenum(buffer_type), index, handle));
+  }
+}
+
 template<IndexedBufferType BUFFER_TYPE, GLuint index>
 void Bind(const IndexedBufferObject<BUFFER_TYPE, index>& buffer) {
-  gl(BindBufferBase(GLenum(BUFFER_TYPE), index, buffer.expose()));
+  OGLWRAP_bindBufferBase(BUFFER_TYPE, index, buffer.expose());
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindBufferRange)
+inline void BindRange(IndexedBufferType buffer_type, GLuint index,
+                      GLuint handle, GLintptr offset, GLsizeiptr size) {
+  // The cache doesn't store the ranges, so this is always executed, and the
+  // indexed binding point becomes unknown (a later Bind() shouldn't be skipped).
+  BindingCache::Binding(BindingKind::kBuffer, GLenum(buffer_type), index) =
+      BindingCache::kUnknown;
+  BindingCache::Update(BindingKind::kBuffer, GLenum(buffer_type), handle);
+  gl(BindBufferRange(GLenum(buffer_type), index, handle, offset, size));
+}
+
 template<IndexedBufferType BUFFER_TYPE, GLuint index>
 void BindRange(const IndexedBufferObject<BUFFER_TYPE, index>& buffer,
                GLintptr offset, GLsizeiptr size) {
-  gl(BindBufferRange(GLenum(BUFFER_TYPE), index, buffer.expose(), offset, size));
+  BindRange(BUFFER_TYPE, index, buffer.expose(), offset, size);
 }
 #endif
 
 template<IndexedBufferType BUFFER_TYPE, GLuint index>
 void Unbind(const IndexedBufferObject<BUFFER_TYPE, index>&) {
-  gl(BindBufferBase(GLenum(BUFFER_TYPE), index, 0));
+  OGLWRAP_bindBufferBase(BUFFER_TYPE, index, 0);
 }
 
 inline void Unbind(IndexedBufferType BUFFER_TYPE, GLuint index) {
-  gl(BindBufferBase(GLenum(BUFFER_TYPE), index, 0));
+  OGLWRAP_bindBufferBase(BUFFER_TYPE, index, 0);
 }
 
 template<IndexedBufferType BUFFER_TYPE, GLuint index>
 bool IsBound(const IndexedBufferObject<BUFFER_TYPE, index>& buffer) {
-  GLint currently_bound_buffer;
-  gl(GetIntegeri_v(GLenum(GetBindingTarget(BUFFER_TYPE)), index,
-                   &currently_bound_buffer));
-  return buffer.expose() == GLuint(currently_bound_buffer);
+  return buffer.expose() == BindingCache::QueryIndexed(
+      BindingKind::kBuffer, GLenum(BUFFER_TYPE),
+      GLenum(GetBindingTarget(BUFFER_TYPE)), index);
 }
 
 template<IndexedBufferType BUFFER_TYPE, GLuint index>
 IndexedBufferObject<BUFFER_TYPE, index> GetCurrentlyBoundObject(const IndexedBufferObject<BUFFER_TYPE, index>*) {
-  GLint currently_bound_buffer;
-  gl(GetIntegeri_v(GLenum(GetBindingTarget(BUFFER_TYPE)), index,
-                   &currently_bound_buffer));
-  return IndexedBufferObject<BUFFER_TYPE, index>{currently_bound_buffer};
+  return IndexedBufferObject<BUFFER_TYPE, index>{BindingCache::QueryIndexed(
+      BindingKind::kBuffer, GLenum(BUFFER_TYPE),
+      GLenum(GetBindingTarget(BUFFER_TYPE)), index)};
 }
 #endif
 
 // Renderbuffer
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindRenderbuffer)
 inline void Bind(const Renderbuffer& buffer) {
-  gl(BindRenderbuffer(GL_RENDERBUFFER, buffer.expose()));
+  if (BindingCache::Update(BindingKind::kRenderbuffer, GL_RENDERBUFFER,
+                           buffer.expose())) {
+    gl(BindRenderbuffer(GL_RENDERBUFFER, buffer.expose()));
+  }
 }
 
-inline void Unbind(const Renderbuffer&) {
-  gl(BindRenderbuffer(GL_RENDERBUFFER, 0));
+inline void Unbind(RenderbufferType) {
+  if (BindingCache::Update(BindingKind::kRenderbuffer, GL_RENDERBUFFER, 0)) {
+    gl(BindRenderbuffer(GL_RENDERBUFFER, 0));
+  }
 }
 
-inline void Unbind(RenderbufferType) {
-  gl(BindRenderbuffer(GL_RENDERBUFFER, 0));
+inline void Unbind(const Renderbuffer&) {
+  Unbind(RenderbufferType::kRenderbuffer);
 }
 
 inline bool IsBound(const Renderbuffer& buffer) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(RenderbufferType::kRenderbuffer)),
-                 &currently_bound_buffer));
-  return buffer.expose() == GLuint(currently_bound_buffer);
+  return buffer.expose() == BindingCache::Query(
+      BindingKind::kRenderbuffer, GL_RENDERBUFFER,
+      GLenum(GetBindingTarget(RenderbufferType::kRenderbuffer)));
 }
 
 inline Renderbuffer GetCurrentlyBoundObject(const Renderbuffer*) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(RenderbufferType::kRenderbuffer)),
-                 &currently_bound_buffer));
-  return Renderbuffer{GLuint(currently_bound_buffer)};
+  return Renderbuffer{BindingCache::Query(
+      BindingKind::kRenderbuffer, GL_RENDERBUFFER,
+      GLenum(GetBindingTarget(RenderbufferType::kRenderbuffer)))};
 }
 #endif  // glBindRenderbuffer
 
 // Framebuffer
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindFramebuffer)
+inline void OGLWRAP_bindFramebuffer(FramebufferType FBO_TYPE, GLuint handle) {
+  bool changed;
+  if (FBO_TYPE == FramebufferType::kFramebuffer) {
+    // GL_FRAMEBUFFER is both the draw and the read framebuffer.
+    bool draw_changed = BindingCache::Update(
+        BindingKind::kFramebuffer, GL_DRAW_FRAMEBUFFER, handle);
+    bool read_changed = BindingCache::Update(
+        BindingKind::kFramebuffer, GL_READ_FRAMEBUFFER, handle);
+    changed = draw_changed || read_changed;
+  } else {
+    changed = BindingCache::Update(BindingKind::kFramebuffer,
+                                   GLenum(FBO_TYPE), handle);
+  }
+  if (changed) {
+    gl(BindFramebuffer(GLenum(FBO_TYPE), handle));
+  }
+}
+
+inline GLuint OGLWRAP_currentlyBoundFramebuffer(FramebufferType FBO_TYPE) {
+  // GL_FRAMEBUFFER_BINDING is the same as GL_DRAW_FRAMEBUFFER_BINDING.
+  GLenum target = FBO_TYPE == FramebufferType::kFramebuffer
+                      ? GL_DRAW_FRAMEBUFFER : GLenum(FBO_TYPE);
+  return BindingCache::Query(BindingKind::kFramebuffer, target,
+                             GLenum(GetBindingTarget(FBO_TYPE)));
+}
+
 template<FramebufferType FBO_TYPE>
 void Bind(const FramebufferObject<FBO_TYPE>& fbo) {
-  gl(BindFramebuffer(GLenum(FBO_TYPE), fbo.expose()));
+  OGLWRAP_bindFramebuffer(FBO_TYPE, fbo.expose());
 }
 
 template<FramebufferType FBO_TYPE>
 void Unbind(const FramebufferObject<FBO_TYPE>& fbo) {
-  gl(BindFramebuffer(GLenum(FBO_TYPE), 0));
+  OGLWRAP_bindFramebuffer(FBO_TYPE, 0);
 }
 
 inline void Unbind(FramebufferType FBO_TYPE) {
-  gl(BindFramebuffer(GLenum(FBO_TYPE), 0));
+  OGLWRAP_bindFramebuffer(FBO_TYPE, 0);
 }
 
 template<FramebufferType FBO_TYPE>
 bool IsBound(const FramebufferObject<FBO_TYPE>& fbo) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(FBO_TYPE)), &currently_bound_buffer));
-  return fbo.expose() == GLuint(currently_bound_buffer);
+  return fbo.expose() == OGLWRAP_currentlyBoundFramebuffer(FBO_TYPE);
 }
 
 template<FramebufferType FBO_TYPE>
 FramebufferObject<FBO_TYPE> GetCurrentlyBoundObject(const FramebufferObject<FBO_TYPE>*) {
-  GLint currently_bound_buffer;
-  gl(GetIntegerv(GLenum(GetBindingTarget(FBO_TYPE)), &currently_bound_buffer));
-  return FramebufferObject<FBO_TYPE>{GLuint(currently_bound_buffer)};
+  return FramebufferObject<FBO_TYPE>{
+      OGLWRAP_currentlyBoundFramebuffer(FBO_TYPE)};
 }
 #endif
 
 
 // TransformFeedback
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindTransformFeedback)
+inline void OGLWRAP_bindTransformFeedback(GLuint handle) {
+  if (BindingCache::Update(BindingKind::kTransformFeedback,
+                           GL_TRANSFORM_FEEDBACK, handle)) {
+    gl(BindTransformFeedback(GL_TRANSFORM_FEEDBACK, handle));
+    // The transform feedback buffer bindings are the state of the tfb object.
+    BindingCache::ForgetTarget(BindingKind::kBuffer,
+                               GL_TRANSFORM_FEEDBACK_BUFFER);
+  }
+}
+
 inline void Bind(const TransformFeedback& tfb)  {
-  gl(BindTransformFeedback(GL_TRANSFORM_FEEDBACK, tfb.expose()));
+  OGLWRAP_bindTransformFeedback(tfb.expose());
 }
 
 inline void Unbind(const TransformFeedback& tfb) {
-  gl(BindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0));
+  OGLWRAP_bindTransformFeedback(0);
 }
 
 inline void Unbind(TransformFeedbackType) {
-  gl(BindTransformFeedback(GL_TRANSFORM_FEEDBACK, 0));
+  OGLWRAP_bindTransformFeedback(0);
 }
 
 inline bool IsBound(const TransformFeedback& tfb)  {
-  GLint currently_bound_tfb;
-  gl(GetIntegerv(GLenum(GetBindingTarget(TransformFeedbackType::kTransformFeedback)),
-                 &currently_bound_tfb));
-  return tfb.expose() == GLuint(currently_bound_tfb);
+  return tfb.expose() == BindingCache::Query(
+      BindingKind::kTransformFeedback, GL_TRANSFORM_FEEDBACK,
+      GLenum(GetBindingTarget(TransformFeedbackType::kTransformFeedback)));
 }
 
 inline TransformFeedback GetCurrentlyBoundObject(const TransformFeedback*) {
-  GLint currently_bound_tfb;
-  gl(GetIntegerv(GLenum(GetBindingTarget(TransformFeedbackType::kTransformFeedback)),
-                 &currently_bound_tfb));
-  return TransformFeedback{GLuint(currently_bound_tfb)};
+  return TransformFeedback{BindingCache::Query(
+      BindingKind::kTransformFeedback, GL_TRANSFORM_FEEDBACK,
+      GLenum(GetBindingTarget(TransformFeedbackType::kTransformFeedback)))};
 }
 #endif
 
 
 // VertexArray
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBindVertexArray)
+inline void OGLWRAP_bindVertexArray(GLuint handle) {
+  if (BindingCache::Update(BindingKind::kVertexArray, GL_VERTEX_ARRAY,
+                           handle)) {
+    gl(BindVertexArray(handle));
+    // The element array buffer binding is the state of the vertex array.
+    BindingCache::ForgetTarget(BindingKind::kBuffer, GL_ELEMENT_ARRAY_BUFFER);
+  }
+}
+
 inline void Bind(const VertexArray& vao) {
-  gl(BindVertexArray(vao.expose()));
+  OGLWRAP_bindVertexArray(vao.expose());
 }
 
 inline void Unbind(const VertexArray& vao) {
-  gl(BindVertexArray(0));
+  OGLWRAP_bindVertexArray(0);
 }
 
 inline void Unbind(VertexArrayType) {
-  gl(BindVertexArray(0));
+  OGLWRAP_bindVertexArray(0);
 }
 
 inline bool IsBound(const VertexArray& vao) {
-  GLint currently_bound_vao;
-  gl(GetIntegerv(GLenum(GetBindingTarget(VertexArrayType::kVertexArray)),
-                 &currently_bound_vao));
-  return vao.expose() == GLuint(currently_bound_vao);
+  return vao.expose() == BindingCache::Query(
+      BindingKind::kVertexArray, GL_VERTEX_ARRAY,
+      GLenum(GetBindingTarget(VertexArrayType::kVertexArray)));
 }
 
 inline VertexArray GetCurrentlyBoundObject(const VertexArray*) {
-  GLint currently_bound_vao;
-  gl(GetIntegerv(GLenum(GetBindingTarget(VertexArrayType::kVertexArray)),
-                 &currently_bound_vao));
-  return VertexArray{ GLuint(currently_bound_vao)};
+  return VertexArray{BindingCache::Query(
+      BindingKind::kVertexArray, GL_VERTEX_ARRAY,
+      GLenum(GetBindingTarget(VertexArrayType::kVertexArray)))};
 }
 #endif
 
 // Texture
 inline void ActiveTexture(GLuint tex_unit) {
+#if OGLWRAP_USE_BINDING_CACHE
+  GLuint& active_unit = BindingCache::ActiveTextureUnit();
+  if (active_unit == tex_unit) {
+    return;
+  }
+  active_unit = tex_unit;
+#endif
   gl(ActiveTexture(GL_TEXTURE0 + tex_unit));
 }
 
+inline void OGLWRAP_bindTexture(TextureType texture_type, GLuint handle) {
+#if OGLWRAP_USE_BINDING_CACHE
+  // The active unit is only needed for the cache, don't query it without it.
+  if (!BindingCache::Update(BindingKind::kTexture, GLenum(texture_type),
+                            handle, BindingCache::QueryActiveTextureUnit())) {
+    return;
+  }
+#endif
+  gl(BindTexture(GLenum(texture_type), handle));
+}
+
+inline void OGLWRAP_bindTextureToTexUnit(TextureType texture_type,
+                                         GLuint handle, GLuint tex_unit) {
+#if OGLWRAP_USE_BINDING_CACHE
+  // If the texture is already bound to that unit, even the active texture
+  // unit doesn't have to be changed.
+  if (BindingCache::Binding(BindingKind::kTexture, GLenum(texture_type),
+                            tex_unit) == handle) {
+    return;
+  }
+#endif
+  ActiveTexture(tex_unit);
+  OGLWRAP_bindTexture(texture_type, handle);
+}
+
 template <TextureType TEXTURE_TYPE>
 void Bind(const TextureBase<TEXTURE_TYPE>& tex) {
-  gl(BindTexture(GLenum(TEXTURE_TYPE), tex.expose()));
+  OGLWRAP_bindTexture(TEXTURE_TYPE, tex.expose());
 }
 
 template <TextureType TEXTURE_TYPE>
 void BindToTexUnit(const TextureBase<TEXTURE_TYPE>& tex, GLuint tex_unit) {
-  gl(ActiveTexture(GL_TEXTURE0 + tex_unit));
-  gl(BindTexture(GLenum(TEXTURE_TYPE), tex.expose()));
+  OGLWRAP_bindTextureToTexUnit(TEXTURE_TYPE, tex.expose(), tex_unit);
 }
 
 template <TextureType TEXTURE_TYPE>
 void Unbind(const TextureBase<TEXTURE_TYPE>& tex) {
-  gl(BindTexture(GLenum(TEXTURE_TYPE), 0));
+  OGLWRAP_bindTexture(TEXTURE_TYPE, 0);
 }
 
 inline void Unbind(TextureType TEXTURE_TYPE) {
-  gl(BindTexture(GLenum(TEXTURE_TYPE), 0));
+  OGLWRAP_bindTexture(TEXTURE_TYPE, 0);
 }
 
 template <TextureType TEXTURE_TYPE>
 void UnbindFromTexUnit(const TextureBase<TEXTURE_TYPE>& tex, GLuint tex_unit) {
-  gl(ActiveTexture(GL_TEXTURE0 + tex_unit));
-  gl(BindTexture(GLenum(TEXTURE_TYPE), 0));
+  OGLWRAP_bindTextureToTexUnit(TEXTURE_TYPE, 0, tex_unit);
 }
 
 inline void UnbindFromTexUnit(TextureType TEXTURE_TYPE, GLuint tex_unit) {
-  gl(ActiveTexture(GL_TEXTURE0 + tex_unit));
-  gl(BindTexture(GLenum(TEXTURE_TYPE), 0));
+  OGLWRAP_bindTextureToTexUnit(TEXTURE_TYPE, 0, tex_unit);
 }
 
 template <TextureType TEXTURE_TYPE>
 bool IsBound(const TextureBase<TEXTURE_TYPE>& tex) {
-  GLint currently_bound_texture;
-  gl(GetIntegerv(GLenum(GetBindingTarget(TEXTURE_TYPE)), &currently_bound_texture));
-  return tex.expose() == GLuint(currently_bound_texture);
+  return tex.expose() == BindingCache::QueryTexture(
+      GLenum(TEXTURE_TYPE), GLenum(GetBindingTarget(TEXTURE_TYPE)));
 }
 
 template <TextureType TEXTURE_TYPE>
 TextureBase<TEXTURE_TYPE> GetCurrentlyBoundObject(const TextureBase<TEXTURE_TYPE>*) {
-  GLint currently_bound_texture;
-  gl(GetIntegerv(GLenum(GetBindingTarget(TEXTURE_TYPE)), &currently_bound_texture));
-  return TextureBase<TEXTURE_TYPE>{GLuint(currently_bound_texture)};
+  return TextureBase<TEXTURE_TYPE>{BindingCache::QueryTexture(
+      GLenum(TEXTURE_TYPE), GLenum(GetBindingTarget(TEXTURE_TYPE)))};
 }
 
 // Program
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUseProgram)
+inline void OGLWRAP_useProgram(GLuint handle) {
+  if (BindingCache::Update(BindingKind::kProgram, GL_CURRENT_PROGRAM, handle)) {
+    gl(UseProgram(handle));
+  }
+}
+
 inline void Bind(const Program& prog) {
 #if OGLWRAP_DEBUG
   if (prog.expose() != 0 && prog.state() != Program::kLinkSuccessful) {
@@ -271,7 +369,7 @@ inline void Bind(const Program& prog) {
     const_cast<Program&>(prog).link();
   }
 #endif
-  gl(UseProgram(prog.expose()));
+  OGLWRAP_useProgram(prog.expose());
 }
 
 inline void Use(const Program& prog) {
@@ -279,30 +377,28 @@ inline void Use(const Program& prog) {
 }
 
 inline void Unbind(const Program&) {
-  gl(UseProgram(0));
+  OGLWRAP_useProgram(0);
 }
 
 inline void Unuse(const Program&) {
-  gl(UseProgram(0));
+  OGLWRAP_useProgram(0);
 }
 
 inline void UnbindProgram() {
-  gl(UseProgram(0));
+  OGLWRAP_useProgram(0);
 }
 
 inline void UnuseProgram() {
-  gl(UseProgram(0));
+  OGLWRAP_useProgram(0);
 }
 
 inline bool IsBound(const Program& prog) {
-  GLint current_program;
-  gl(GetIntegerv(GL_CURRENT_PROGRAM, &current_program));
-
 #if OGLWRAP_DEBUG
   DebugOutput::LastUsedBindTarget() = "GL_CURRENT_PROGRAM";
 #endif
 
-  return prog.expose() == GLuint(current_program);
+  return prog.expose() == BindingCache::Query(
+      BindingKind::kProgram, GL_CURRENT_PROGRAM, GL_CURRENT_PROGRAM);
 }
 
 inline bool IsActive(const Program& prog) {
@@ -310,9 +406,46 @@ inline bool IsActive(const Program& prog) {
 }
 
 inline Program GetCurrentlyBoundObject(const Program*) {
-  GLint current_program;
-  gl(GetIntegerv(GL_CURRENT_PROGRAM, &current_program));
-  return Program{GLuint(current_program)};
+  return Program{BindingCache::Query(
+      BindingKind::kProgram, GL_CURRENT_PROGRAM, GL_CURRENT_PROGRAM)};
+}
+#endif
+
+// ProgramPipeline
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glBindProgramPipeline) && \
+    defined(glUseProgram))
+inline void OGLWRAP_bindProgramPipeline(GLuint handle) {
+  if (BindingCache::Update(BindingKind::kProgramPipeline,
+                           GL_PROGRAM_PIPELINE_BINDING, handle)) {
+    gl(BindProgramPipeline(handle));
+  }
+}
+
+/// Binds a program pipeline (and stops using the current program, as that
+/// would override the pipeline).
+inline void Bind(const ProgramPipeline& pipeline) {
+  OGLWRAP_useProgram(0);
+  OGLWRAP_bindProgramPipeline(pipeline.expose());
+}
+
+inline void Unbind(const ProgramPipeline&) {
+  OGLWRAP_bindProgramPipeline(0);
+}
+
+inline bool IsBound(const ProgramPipeline& pipeline) {
+#if OGLWRAP_DEBUG
+  DebugOutput::LastUsedBindTarget() = "GL_PROGRAM_PIPELINE_BINDING";
+#endif
+
+  return pipeline.expose() == BindingCache::Query(
+      BindingKind::kProgramPipeline, GL_PROGRAM_PIPELINE_BINDING,
+      GL_PROGRAM_PIPELINE_BINDING);
+}
+
+inline ProgramPipeline GetCurrentlyBoundObject(const ProgramPipeline*) {
+  return ProgramPipeline{BindingCache::Query(
+      BindingKind::kProgramPipeline, GL_PROGRAM_PIPELINE_BINDING,
+      GL_PROGRAM_PIPELINE_BINDING)};
 }
 #endif
 
@@ -0,0 +1,231 @@
+// Copyright (c) Tamas Csala
+
+/** @file binding_cache.h
+    @brief Implements a client side shadow of the context's binding points.
+*/
+
+#ifndef OGLWRAP_CONTEXT_BINDING_CACHE_H_
+#define OGLWRAP_CONTEXT_BINDING_CACHE_H_
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "../config.h"
+
+#include "../define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// The kinds of objects, whose bindings are tracked by the BindingCache.
+enum class BindingKind : std::uint8_t {
+  kBuffer,
+  kTexture,
+  kFramebuffer,
+  kRenderbuffer,
+  kTransformFeedback,
+  kVertexArray,
+  kProgram,
+  kProgramPipeline
+};
+
+/// A client side copy of the objects bound to the current context.
+/** Every Bind() and Unbind() that goes through oglwrap updates the cache, so
+  * binding an object that is already bound doesn't reach the driver, and
+  * IsBound() (so the bind checks too) can be answered without a glGet call.
+  * Binding points that oglwrap didn't modify yet are unknown, and are queried
+  * from the driver on their first use.
+  *
+  * The cache can't see what happens behind its back, so Invalidate() has to be
+  * called after calling code that modifies the bindings without oglwrap (like
+  * a third party library, or direct gl calls), and after making a different
+  * context current.
+  *
+  * Only used if OGLWRAP_USE_BINDING_CACHE is true. */
+class BindingCache {
+ public:
+  /// The value of the binding points that aren't known by the cache.
+  enum : GLuint { kUnknown = ~GLuint(0) };
+
+  /// The index used for the binding points that aren't indexed.
+  enum : GLuint { kNonIndexed = ~GLuint(0) };
+
+  /// Forgets every binding, they will be queried from the driver again.
+  static void Invalidate() {
+    GetInstanceSingleton().bindings_.clear();
+    GetInstanceSingleton().active_texture_unit_ = kUnknown;
+  }
+
+  /// Returns the cached value of a binding point (kUnknown if it isn't known).
+  /** @param kind    The kind of the object that can be bound to the target.
+    * @param target  The binding target (like GL_ARRAY_BUFFER).
+    * @param index   The index of the binding point for indexed targets, or the
+    *                texture unit for textures. */
+  static GLuint& Binding(BindingKind kind, GLenum target,
+                         GLuint index = kNonIndexed) {
+    auto& bindings = GetInstanceSingleton().bindings_;
+    std::uint64_t key = Key(kind, target, index);
+    // Only insert on a miss, emplace would allocate a node on every call.
+    auto iter = bindings.find(key);
+    if (iter != bindings.end()) {
+      return iter->second;
+    }
+    return bindings.emplace(key, kUnknown).first->second;
+  }
+
+  /// Returns the cached active texture unit (kUnknown if it isn't known).
+  static GLuint& ActiveTextureUnit() {
+    return GetInstanceSingleton().active_texture_unit_;
+  }
+
+  /// Forgets every binding point, that the given object is bound to.
+  /** Has to be called when an object is deleted, as the deletion unbinds it,
+    * and its name might be reused by a newly created object. */
+  static void Forget(BindingKind kind, GLuint handle) {
+    for (auto& binding : GetInstanceSingleton().bindings_) {
+      if (KindOf(binding.first) == kind && binding.second == handle) {
+        binding.second = kUnknown;
+      }
+    }
+  }
+
+  /// Forgets every binding point (on every index) of a target.
+  /** Used when the binding points of the target are the state of another
+    * object (like GL_ELEMENT_ARRAY_BUFFER is the state of the vertex array). */
+  static void ForgetTarget(BindingKind kind, GLenum target) {
+    for (auto& binding : GetInstanceSingleton().bindings_) {
+      if (KindOf(binding.first) == kind && TargetOf(binding.first) == target) {
+        binding.second = kUnknown;
+      }
+    }
+  }
+
+  /// Returns the object bound to a target, queries it only if it isn't known.
+  /** @param kind            The kind of the object that can be bound.
+    * @param target          The binding target (like GL_ARRAY_BUFFER).
+    * @param binding_target  The binding's name for glGet (like
+    *                        GL_ARRAY_BUFFER_BINDING). */
+  static GLuint Query(BindingKind kind, GLenum target, GLenum binding_target) {
+  #if OGLWRAP_USE_BINDING_CACHE
+    GLuint& binding = Binding(kind, target);
+    if (binding == kUnknown) {
+      GLint currently_bound;
+      gl(GetIntegerv(binding_target, &currently_bound));
+      binding = currently_bound;
+    }
+    return binding;
+  #else
+    (void)kind;
+    (void)target;
+    GLint currently_bound;
+    gl(GetIntegerv(binding_target, &currently_bound));
+    return currently_bound;
+  #endif
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glGetIntegeri_v)
+  /// Returns the object bound to an indexed target, queries it only if needed.
+  static GLuint QueryIndexed(BindingKind kind, GLenum target,
+                             GLenum binding_target, GLuint index) {
+  #if OGLWRAP_USE_BINDING_CACHE
+    GLuint& binding = Binding(kind, target, index);
+    if (binding == kUnknown) {
+      GLint currently_bound;
+      gl(GetIntegeri_v(binding_target, index, &currently_bound));
+      binding = currently_bound;
+    }
+    return binding;
+  #else
+    (void)kind;
+    (void)target;
+    GLint currently_bound;
+    gl(GetIntegeri_v(binding_target, index, &currently_bound));
+    return currently_bound;
+  #endif
+  }
+#endif
+
+  /// Returns the active texture unit, queries it only if it isn't known.
+  static GLuint QueryActiveTextureUnit() {
+  #if OGLWRAP_USE_BINDING_CACHE
+    GLuint& unit = ActiveTextureUnit();
+    if (unit == kUnknown) {
+      GLint active_texture;
+      gl(GetIntegerv(GL_ACTIVE_TEXTURE, &active_texture));
+      unit = active_texture - GL_TEXTURE0;
+    }
+    return unit;
+  #else
+    GLint active_texture;
+    gl(GetIntegerv(GL_ACTIVE_TEXTURE, &active_texture));
+    return active_texture - GL_TEXTURE0;
+  #endif
+  }
+
+  /// Returns the texture bound to a target of the active texture unit.
+  static GLuint QueryTexture(GLenum target, GLenum binding_target) {
+  #if OGLWRAP_USE_BINDING_CACHE
+    GLuint& binding = Binding(BindingKind::kTexture, target,
+                              QueryActiveTextureUnit());
+    if (binding == kUnknown) {
+      GLint currently_bound;
+      gl(GetIntegerv(binding_target, &currently_bound));
+      binding = currently_bound;
+    }
+    return binding;
+  #else
+    (void)target;
+    GLint currently_bound;
+    gl(GetIntegerv(binding_target, &currently_bound));
+    return currently_bound;
+  #endif
+  }
+
+  /// Records that an object is going to be bound to a binding point.
+  /** @return false if the object is already bound there, so the bind call can
+    *         be skipped. Always true if OGLWRAP_USE_BINDING_CACHE is false. */
+  static bool Update(BindingKind kind, GLenum target, GLuint handle,
+                     GLuint index = kNonIndexed) {
+  #if OGLWRAP_USE_BINDING_CACHE
+    GLuint& binding = Binding(kind, target, index);
+    if (binding == handle) {
+      return false;
+    }
+    binding = handle;
+  #else
+    (void)kind;
+    (void)target;
+    (void)handle;
+    (void)index;
+  #endif
+    return true;
+  }
+
+ private:
+  std::unordered_map<std::uint64_t, GLuint> bindings_;
+  GLuint active_texture_unit_ = kUnknown;
+
+  BindingCache() = default;
+
+  static BindingCache& GetInstanceSingleton() {
+    static BindingCache instance;
+    return instance;
+  }
+
+  static std::uint64_t Key(BindingKind kind, GLenum target, GLuint index) {
+    return std::uint64_t(kind) << 56 | std::uint64_t(target) << 32 | index;
+  }
+
+  static BindingKind KindOf(std::uint64_t key) {
+    return BindingKind(key >> 56);
+  }
+
+  static GLenum TargetOf(std::uint64_t key) {
+    return GLenum((key >> 32) & 0xFFFFFF);
+  }
+};
+
+}  // namespace oglwrap
+
+#include "../undefine_internal_macros.h"
+
+#endif  // OGLWRAP_CONTEXT_BINDING_CACHE_H_
@@ -9,6 +9,7 @@
 #include "../config.h"
 #include "../enums/blend_equation.h"
 #include "../enums/blend_function.h"
+#include "./state_cache.h"
 
 #include "../define_internal_macros.h"
 
@@ -22,7 +23,10 @@ namespace OGLWRAP_NAMESPACE_NAME {
  * @version 1.0
  */
 inline void BlendEquation(enums::BlendEquation eq) {
-  gl(BlendEquation(GLenum(eq)));
+  if (StateCache::Update(GL_BLEND_EQUATION_RGB,
+                         StateCache::Value(GLenum(eq), GLenum(eq)))) {
+    gl(BlendEquation(GLenum(eq)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBlendEquationi)
@@ -36,7 +40,10 @@ inline void BlendEquation(enums::BlendEquation eq) {
  * @version 4.0
  */
 inline void BlendEquation(GLuint buffer, enums::BlendEquation eq) {
-  gl(BlendEquationi(buffer, GLenum(eq)));
+  if (StateCache::UpdateIndexed(GL_BLEND_EQUATION_RGB, buffer,
+                                StateCache::Value(GLenum(eq), GLenum(eq)))) {
+    gl(BlendEquationi(buffer, GLenum(eq)));
+  }
 }
 #endif
 
@@ -54,7 +61,10 @@ inline void BlendEquation(GLuint buffer, enums::BlendEquation eq) {
  */
 inline void BlendEquationSeparate(enums::BlendEquation mode_rgb,
                                  enums::BlendEquation mode_a) {
-  gl(BlendEquationSeparate(GLenum(mode_rgb), GLenum(mode_a)));
+  if (StateCache::Update(GL_BLEND_EQUATION_RGB,
+                         StateCache::Value(GLenum(mode_rgb), GLenum(mode_a)))) {
+    gl(BlendEquationSeparate(GLenum(mode_rgb), GLenum(mode_a)));
+  }
 }
 #endif
 
@@ -74,7 +84,11 @@ inline void BlendEquationSeparate(enums::BlendEquation mode_rgb,
  */
 inline void BlendEquationSeparate(GLuint buffer, enums::BlendEquation mode_rgb,
                                  enums::BlendEquation mode_a) {
-  gl(BlendEquationSeparatei(buffer, GLenum(mode_rgb), GLenum(mode_a)));
+  if (StateCache::UpdateIndexed(
+      GL_BLEND_EQUATION_RGB, buffer,
+      StateCache::Value(GLenum(mode_rgb), GLenum(mode_a)))) {
+    gl(BlendEquationSeparatei(buffer, GLenum(mode_rgb), GLenum(mode_a)));
+  }
 }
 #endif
 
@@ -83,7 +97,10 @@ inline void BlendEquationSeparate(GLuint buffer, enums::BlendEquation mode_rgb,
  * @version 1.0
  */
 inline void BlendFunc(enums::BlendFunction src, enums::BlendFunction dst) {
-  gl(BlendFunc(GLenum(src), GLenum(dst)));
+  if (StateCache::Update(GL_BLEND_SRC_RGB, StateCache::Value(
+      GLenum(src), GLenum(dst), GLenum(src), GLenum(dst)))) {
+    gl(BlendFunc(GLenum(src), GLenum(dst)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glBlendFunci)
@@ -93,7 +110,10 @@ inline void BlendFunc(enums::BlendFunction src, enums::BlendFunction dst) {
  */
 inline void BlendFunc(GLuint buffer, enums::BlendFunction src,
                      enums::BlendFunction dst) {
-  gl(BlendFunci(buffer, GLenum(src), GLenum(dst)));
+  if (StateCache::UpdateIndexed(GL_BLEND_SRC_RGB, buffer, StateCache::Value(
+      GLenum(src), GLenum(dst), GLenum(src), GLenum(dst)))) {
+    gl(BlendFunci(buffer, GLenum(src), GLenum(dst)));
+  }
 }
 #endif
 
@@ -106,8 +126,11 @@ inline void BlendFuncSeparate(enums::BlendFunction src_rgb,
                               enums::BlendFunction dst_rgb,
                               enums::BlendFunction src_a,
                               enums::BlendFunction dst_a) {
-  gl(BlendFuncSeparate(GLenum(src_rgb), GLenum(dst_rgb),
-                       GLenum(src_a), GLenum(dst_a)));
+  if (StateCache::Update(GL_BLEND_SRC_RGB, StateCache::Value(
+      GLenum(src_rgb), GLenum(dst_rgb), GLenum(src_a), GLenum(dst_a)))) {
+    gl(BlendFuncSeparate(GLenum(src_rgb), GLenum(dst_rgb),
+                         GLenum(src_a), GLenum(dst_a)));
+  }
 }
 #endif
 
@@ -121,8 +144,11 @@ inline void BlendFuncSeparate(GLuint buffer,
                               enums::BlendFunction dst_rgb,
                               enums::BlendFunction src_a,
                               enums::BlendFunction dst_a) {
-  gl(BlendFuncSeparatei(buffer, GLenum(src_rgb), GLenum(dst_rgb),
-                        GLenum(src_a), GLenum(dst_a)));
+  if (StateCache::UpdateIndexed(GL_BLEND_SRC_RGB, buffer, StateCache::Value(
+      GLenum(src_rgb), GLenum(dst_rgb), GLenum(src_a), GLenum(dst_a)))) {
+    gl(BlendFuncSeparatei(buffer, GLenum(src_rgb), GLenum(dst_rgb),
+                          GLenum(src_a), GLenum(dst_a)));
+  }
 }
 #endif
 
@@ -130,17 +156,20 @@ inline void BlendFuncSeparate(GLuint buffer,
  * @see glBlendColor
  * @version 1.0
  */
-inline void BlendColor(glm::vec4 blend_color) {
-  gl(BlendColor(blend_color.r, blend_color.g, blend_color.b, blend_color.a));
+inline void BlendColor(GLfloat red, GLfloat green,
+                       GLfloat blue, GLfloat alpha) {
+  if (StateCache::Update(GL_BLEND_COLOR, StateCache::Value::FromFloats(
+      red, green, blue, alpha))) {
+    gl(BlendColor(red, green, blue, alpha));
+  }
 }
 
 /**
  * @see glBlendColor
  * @version 1.0
  */
-inline void BlendColor(GLfloat red, GLfloat green,
-                       GLfloat blue, GLfloat alpha) {
-  gl(BlendColor(red, green, blue, alpha));
+inline void BlendColor(glm::vec4 blend_color) {
+  BlendColor(blend_color.r, blend_color.g, blend_color.b, blend_color.a);
 }
 
 } // namespace oglwrap
@@ -6,6 +6,7 @@
 #include <tuple>
 #include "../config.h"
 #include "../enums/face.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -13,7 +14,9 @@ namespace OGLWRAP_NAMESPACE_NAME {
 /// Enables and disables writing of frame buffer color components.
 /** @see glColorMask */
 inline void ColorMask(bool r, bool g, bool b, bool a) {
-  gl(ColorMask(r, g, b, a));
+  if (StateCache::Update(GL_COLOR_WRITEMASK, StateCache::Value(r, g, b, a))) {
+    gl(ColorMask(r, g, b, a));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_COLOR_WRITEMASK)
@@ -31,14 +34,19 @@ inline std::tuple<GLboolean, GLboolean, GLboolean, GLboolean> ColorMask() {
 /// Enables and disables writing of frame buffer color components for a particular buffer.
 /** @see glColorMaski */
 inline void ColorMask(GLuint buffer, bool r, bool g, bool b, bool a) {
-  gl(ColorMaski(buffer, r, g, b, a));
+  if (StateCache::UpdateIndexed(GL_COLOR_WRITEMASK, buffer,
+                                StateCache::Value(r, g, b, a))) {
+    gl(ColorMaski(buffer, r, g, b, a));
+  }
 }
 #endif
 
 /// Enables or disables writing into the depth buffer.
 /** @see glDepthMask */
 inline void DepthMask(bool mask) {
-  gl(DepthMask(mask));
+  if (StateCache::Update(GL_DEPTH_WRITEMASK, mask)) {
+    gl(DepthMask(mask));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_DEPTH_WRITEMASK)
@@ -54,14 +62,27 @@ inline bool DepthMask() {
 /// Controls the front and back writing of individual bits in the stencil planes.
 /** @see glStencilMask */
 inline void StencilMask(GLuint mask) {
-  gl(StencilMask(mask));
+  bool front_changed = StateCache::Update(GL_STENCIL_WRITEMASK, mask);
+  bool back_changed = StateCache::Update(GL_STENCIL_BACK_WRITEMASK, mask);
+  if (front_changed || back_changed) {
+    gl(StencilMask(mask));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glStencilMaskSeparate)
 /// Control the front and/or back writing of individual bits in the stencil planes.
 /** @see glStencilMaskSeparate */
 inline void StencilMask(Face face, GLuint mask) {
-  gl(StencilMaskSeparate(GLenum(face), mask));
+  bool changed = false;
+  if (face != Face::kBack) {
+    changed |= StateCache::Update(GL_STENCIL_WRITEMASK, mask);
+  }
+  if (face != Face::kFront) {
+    changed |= StateCache::Update(GL_STENCIL_BACK_WRITEMASK, mask);
+  }
+  if (changed) {
+    gl(StencilMaskSeparate(GLenum(face), mask));
+  }
 }
 #endif
 
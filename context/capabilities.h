@@ -8,6 +8,7 @@
 
 #include "../config.h"
 #include "../enums/capability.h"
+#include "./state_cache.h"
 
 #include "../define_internal_macros.h"
 
@@ -16,42 +17,63 @@ namespace OGLWRAP_NAMESPACE_NAME {
 /// Enables a capability.
 /** @see glEnable */
 inline void Enable(Capability capability) {
-  gl(Enable(GLenum(capability)));
+  if (StateCache::Update(GLenum(capability), true)) {
+    gl(Enable(GLenum(capability)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glEnablei)
 /// Enables a capability for an index target.
 /** @see glEnablei */
 inline void Enable(Capability capability, GLuint index) {
-	gl(Enablei(GLenum(capability), index));
+  if (StateCache::UpdateIndexed(GLenum(capability), index, true)) {
+    gl(Enablei(GLenum(capability), index));
+  }
 }
 #endif
 
 /// Disables a capability.
 /** @see glDisable */
 inline void Disable(Capability capability) {
-	gl(Disable(GLenum(capability)));
+  if (StateCache::Update(GLenum(capability), false)) {
+    gl(Disable(GLenum(capability)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glDisablei)
 /// Disables a capability for an index target.
 /** @see glDisablei */
 inline void Disable(Capability capability, GLuint index) {
-	gl(Disablei(GLenum(capability), index));
+  if (StateCache::UpdateIndexed(GLenum(capability), index, false)) {
+    gl(Disablei(GLenum(capability), index));
+  }
 }
 #endif
 
 /// Checks if a capability is enabled.
 /** @see glIsEnabled */
 inline bool IsEnabled(Capability capability) {
-	return gl(IsEnabled(GLenum(capability)));
+  if (const StateCache::Value* cached = StateCache::Get(GLenum(capability))) {
+    return cached->data[0];
+  }
+  bool enabled = gl(IsEnabled(GLenum(capability)));
+  // Only the first index is known, the others might have been set with
+  // Enable(capability, index) before.
+  StateCache::UpdateIndexed(GLenum(capability), 0, enabled);
+  return enabled;
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glIsEnabledi)
 /// Checks if a capability is enabled for an index target.
 /** @see glIsEnabledi */
 inline bool IsEnabled(Capability capability, GLuint index) {
-	return gl(IsEnabledi(GLenum(capability), index));
+  if (const StateCache::Value* cached =
+      StateCache::GetIndexed(GLenum(capability), index)) {
+    return cached->data[0];
+  }
+  bool enabled = gl(IsEnabledi(GLenum(capability), index));
+  StateCache::UpdateIndexed(GLenum(capability), index, enabled);
+  return enabled;
 }
 #endif
 
@@ -5,6 +5,7 @@
 
 #include "../config.h"
 #include "../enums/compare_func.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -53,7 +54,9 @@ namespace OGLWRAP_NAMESPACE_NAME {
  * @version OpenGL 1.0
  */
 inline void DepthFunc(CompareFunc function) {
-  gl(DepthFunc(GLenum(function)));
+  if (StateCache::Update(GL_DEPTH_FUNC, GLenum(function))) {
+    gl(DepthFunc(GLenum(function)));
+  }
 }
 
 /**
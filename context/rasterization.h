@@ -11,6 +11,7 @@
 #include "../enums/face_orientation.h"
 #include "../enums/poly_mode.h"
 #include "../enums/provoke_mode.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -18,7 +19,9 @@ namespace OGLWRAP_NAMESPACE_NAME {
 /// Define front- and back-facing polygons.
 /** @see glFrontFace */
 inline void FrontFace(FaceOrientation orintation) {
-	gl(FrontFace(GLenum(orintation)));
+  if (StateCache::Update(GL_FRONT_FACE, GLenum(orintation))) {
+    gl(FrontFace(GLenum(orintation)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_FRONT_FACE)
@@ -34,7 +37,9 @@ inline FaceOrientation FrontFace() {
 /// Specify whether front- or back-facing facets can be culled.
 /** @see glCullFace */
 inline void CullFace(Face face) {
-	gl(CullFace(GLenum(face)));
+  if (StateCache::Update(GL_CULL_FACE_MODE, GLenum(face))) {
+    gl(CullFace(GLenum(face)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_CULL_FACE_MODE)
@@ -50,13 +55,22 @@ inline Face CullFace() {
 /// Sets the polygon rasterization mode.
 /** @see glPolygonMode */
 inline void PolygonMode(Face face, PolyMode mode) {
-	gl(PolygonMode(GLenum(face), GLenum(mode)));
+  if (face == Face::kFrontAndBack) {
+    if (!StateCache::Update(GL_POLYGON_MODE,
+                            StateCache::Value(GLenum(mode), GLenum(mode)))) {
+      return;
+    }
+  } else {
+    // Only the mode of both faces is cached.
+    StateCache::Forget(GL_POLYGON_MODE);
+  }
+  gl(PolygonMode(GLenum(face), GLenum(mode)));
 }
 
 /// Sets the polygon rasterization mode.
 /** @see glPolygonMode */
 inline void PolygonMode(PolyMode mode) {
-	gl(PolygonMode(GLenum(Face::kFrontAndBack), GLenum(mode)));
+  PolygonMode(Face::kFrontAndBack, mode);
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_POLYGON_MODE)
@@ -72,7 +86,10 @@ inline PolyMode PolygonMode() {
 /// Sets the scale and units used to calculate depth values.
 /** @see glPolygonOffset */
 inline void PolygonOffset(GLfloat factor, GLfloat units) {
-	gl(PolygonOffset(factor, units));
+  if (StateCache::Update(GL_POLYGON_OFFSET_FACTOR,
+                         StateCache::Value::FromFloats(factor, units, 0, 0))) {
+    gl(PolygonOffset(factor, units));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING \
@@ -90,7 +107,10 @@ inline glm::vec2 PolygonOffset() {
 /// Sets the width of rasterized lines.
 /** @see glLineWidth */
 inline void LineWidth(GLfloat width) {
-	gl(LineWidth(width));
+  if (StateCache::Update(GL_LINE_WIDTH,
+                         StateCache::Value::FromFloats(width, 0, 0, 0))) {
+    gl(LineWidth(width));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_LINE_WIDTH)
@@ -7,6 +7,7 @@
 #include <glm/glm.hpp>
 
 #include "../config.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -36,7 +37,10 @@ namespace OGLWRAP_NAMESPACE_NAME {
  * @version OpenGL 1.1
  */
 inline void Scissor(GLint left, GLint bottom, GLsizei width, GLsizei height) {
-  gl(Scissor(left, bottom, width, height));
+  if (StateCache::Update(GL_SCISSOR_BOX, StateCache::Value(
+      left, bottom, width, height))) {
+    gl(Scissor(left, bottom, width, height));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glScissorIndexed)
@@ -68,7 +72,10 @@ inline void Scissor(GLint left, GLint bottom, GLsizei width, GLsizei height) {
  */
 inline void Scissor(GLuint viewport, GLint left, GLint bottom,
                     GLsizei width, GLsizei height) {
-  gl(ScissorIndexed(viewport, left, bottom, width, height));
+  if (StateCache::UpdateIndexed(GL_SCISSOR_BOX, viewport, StateCache::Value(
+      left, bottom, width, height))) {
+    gl(ScissorIndexed(viewport, left, bottom, width, height));
+  }
 }
 #endif
 
@@ -101,7 +108,10 @@ inline void Scissor(GLuint viewport, GLint left, GLint bottom,
  * @version OpenGL 4.1
  */
 inline void Scissor(GLuint viewport, GLint *v) {
-  gl(ScissorIndexedv(viewport, v));
+  if (StateCache::UpdateIndexed(GL_SCISSOR_BOX, viewport, StateCache::Value(
+      v[0], v[1], v[2], v[3]))) {
+    gl(ScissorIndexedv(viewport, v));
+  }
 }
 #endif
 
@@ -138,6 +148,10 @@ inline void Scissor(GLuint viewport, GLint *v) {
  * @version OpenGL 4.1
  */
 inline void ScissorArray(GLuint first, GLuint count, GLint *v) {
+  for (GLuint i = 0; i < count; ++i) {
+    StateCache::UpdateIndexed(GL_SCISSOR_BOX, first + i, StateCache::Value(
+        v[4*i + 0], v[4*i + 1], v[4*i + 2], v[4*i + 3]));
+  }
   gl(ScissorArrayv(first, count, v));
 }
 #endif
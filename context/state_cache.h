@@ -0,0 +1,162 @@
+// Copyright (c) Tamas Csala
+
+/** @file state_cache.h
+    @brief Implements a client side shadow of the fixed function render state.
+*/
+
+#ifndef OGLWRAP_CONTEXT_STATE_CACHE_H_
+#define OGLWRAP_CONTEXT_STATE_CACHE_H_
+
+#include <cstring>
+#include <unordered_map>
+
+#include "../config.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// A client side copy of the context's fixed function state.
+/** The setters of the capabilities, blending, depth and stencil test, scissor
+  * box, write masks, face culling, polygon mode and offset, line width and
+  * viewport record the values they set, and skip the gl call if the state
+  * already has that value. Checking if a capability is enabled is
+  * answered from the cache too (that makes TemporaryEnable and TemporarySet
+  * cheap). The state that wasn't set through oglwrap yet is unknown, so
+  * setting it always reaches the driver.
+  *
+  * Every piece of state is identified by the enum that queries it, and
+  * optionally an index (for the glEnablei, glBlendFunci, glScissorIndexed...
+  * like functions). Setting the non-indexed state sets every index.
+  *
+  * Invalidate() has to be called after code that modifies the state without
+  * oglwrap, and after making a different context current.
+  *
+  * Only used if OGLWRAP_USE_STATE_CACHE is true. */
+class StateCache {
+ public:
+  /// The value of a piece of state (at most four integers).
+  struct Value {
+    GLint data[4];
+
+    Value(GLint x = 0, GLint y = 0, GLint z = 0, GLint w = 0)
+        : data{x, y, z, w} {}
+
+    /// Stores floats by their bit pattern.
+    static Value FromFloats(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+      Value value;
+      GLfloat floats[4] = {x, y, z, w};
+      std::memcpy(value.data, floats, sizeof(floats));
+      return value;
+    }
+
+    bool operator==(const Value& other) const {
+      return data[0] == other.data[0] && data[1] == other.data[1] &&
+             data[2] == other.data[2] && data[3] == other.data[3];
+    }
+
+    bool operator!=(const Value& other) const { return !(*this == other); }
+  };
+
+  /// Forgets every state, the next setter calls will reach the driver.
+  static void Invalidate() {
+    GetInstanceSingleton().states_.clear();
+  }
+
+  /// Forgets a piece of state (with all of its indices).
+  static void Forget(GLenum state) {
+    GetInstanceSingleton().states_.erase(state);
+  }
+
+  /// Records the new value of a piece of state (for every index).
+  /** @return false if the state already had that value, so the gl call can be
+    *         skipped. Always true if OGLWRAP_USE_STATE_CACHE is false. */
+  static bool Update(GLenum state, const Value& value) {
+  #if OGLWRAP_USE_STATE_CACHE
+    State& cached = GetInstanceSingleton().states_[state];
+    if (cached.known && cached.indexed.empty() && cached.value == value) {
+      return false;
+    }
+    cached.indexed.clear();
+    cached.known = true;
+    cached.value = value;
+  #else
+    (void)state;
+    (void)value;
+  #endif
+    return true;
+  }
+
+  /// Records the new value of an indexed piece of state.
+  /** @return false if the state already had that value, so the gl call can be
+    *         skipped. Always true if OGLWRAP_USE_STATE_CACHE is false. */
+  static bool UpdateIndexed(GLenum state, GLuint index, const Value& value) {
+  #if OGLWRAP_USE_STATE_CACHE
+    State& cached = GetInstanceSingleton().states_[state];
+    auto iter = cached.indexed.find(index);
+    if (iter != cached.indexed.end()) {
+      if (iter->second == value) {
+        return false;
+      }
+      iter->second = value;
+    } else {
+      if (cached.known && cached.value == value) {
+        return false;
+      }
+      cached.indexed.emplace(index, value);
+    }
+  #else
+    (void)state;
+    (void)index;
+    (void)value;
+  #endif
+    return true;
+  }
+
+  /// Returns the cached value of a piece of state, or nullptr if it's unknown.
+  /** For indexed states, this is the value of the first index (just like what
+    * glGet returns). */
+  static const Value* Get(GLenum state) {
+    return GetIndexed(state, 0);
+  }
+
+  /// Returns the cached value of an indexed state, or nullptr if it's unknown.
+  static const Value* GetIndexed(GLenum state, GLuint index) {
+  #if OGLWRAP_USE_STATE_CACHE
+    auto& states = GetInstanceSingleton().states_;
+    auto iter = states.find(state);
+    if (iter != states.end()) {
+      const State& cached = iter->second;
+      auto indexed_iter = cached.indexed.find(index);
+      if (indexed_iter != cached.indexed.end()) {
+        return &indexed_iter->second;
+      } else if (cached.known) {
+        return &cached.value;
+      }
+    }
+  #else
+    (void)state;
+    (void)index;
+  #endif
+    return nullptr;
+  }
+
+ private:
+  struct State {
+    /// If the value of the indices, that aren't in the indexed map, is known.
+    bool known = false;
+    Value value;
+    std::unordered_map<GLuint, Value> indexed;
+  };
+
+  std::unordered_map<GLenum, State> states_;
+
+  StateCache() = default;
+
+  static StateCache& GetInstanceSingleton() {
+    static StateCache instance;
+    return instance;
+  }
+};
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_CONTEXT_STATE_CACHE_H_
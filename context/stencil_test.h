@@ -7,6 +7,7 @@
 #include "../enums/face.h"
 #include "../enums/compare_func.h"
 #include "../enums/stencil_operation.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -79,7 +80,13 @@ namespace OGLWRAP_NAMESPACE_NAME {
 inline void StencilFunc(CompareFunc func,
                         GLint ref=GLint(0),
                         GLuint mask=~GLuint(0)) {
-  gl(StencilFunc(GLenum(func), ref, mask));
+  StateCache::Value value(GLenum(func), ref, mask);
+  // Non-short-circuit evaluation, both faces have to be updated.
+  bool front_changed = StateCache::Update(GL_STENCIL_FUNC, value);
+  bool back_changed = StateCache::Update(GL_STENCIL_BACK_FUNC, value);
+  if (front_changed || back_changed) {
+    gl(StencilFunc(GLenum(func), ref, mask));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glStencilFuncSeparate)
@@ -153,7 +160,17 @@ inline void StencilFuncSeparate(Face face,
                                 CompareFunc func,
                                 GLint ref=GLint(0),
                                 GLuint mask=~GLuint(0)) {
-  gl(StencilFuncSeparate(GLenum(face), GLenum(func), ref, mask));
+  StateCache::Value value(GLenum(func), ref, mask);
+  bool changed = false;
+  if (face != Face::kBack) {
+    changed |= StateCache::Update(GL_STENCIL_FUNC, value);
+  }
+  if (face != Face::kFront) {
+    changed |= StateCache::Update(GL_STENCIL_BACK_FUNC, value);
+  }
+  if (changed) {
+    gl(StencilFuncSeparate(GLenum(face), GLenum(func), ref, mask));
+  }
 }
 #endif
 
@@ -227,7 +244,13 @@ inline void StencilFuncSeparate(Face face,
 inline void StencilOp(StencilOperation sfail = StencilOperation::kKeep,
                       StencilOperation dfail = StencilOperation::kKeep,
                       StencilOperation dpass = StencilOperation::kKeep) {
-  gl(StencilOp(GLenum(sfail), GLenum(dfail), GLenum(dpass)));
+  StateCache::Value value =
+      StateCache::Value(GLenum(sfail), GLenum(dfail), GLenum(dpass));
+  bool front_changed = StateCache::Update(GL_STENCIL_FAIL, value);
+  bool back_changed = StateCache::Update(GL_STENCIL_BACK_FAIL, value);
+  if (front_changed || back_changed) {
+    gl(StencilOp(GLenum(sfail), GLenum(dfail), GLenum(dpass)));
+  }
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glStencilOpSeparate)
@@ -305,8 +328,19 @@ inline void StencilOpSeparate(Face face,
                               StencilOperation sfail = StencilOperation::kKeep,
                               StencilOperation dfail = StencilOperation::kKeep,
                               StencilOperation dpass = StencilOperation::kKeep) {
-  gl(StencilOpSeparate(GLenum(face), GLenum(sfail),
-                       GLenum(dfail), GLenum(dpass)));
+  StateCache::Value value =
+      StateCache::Value(GLenum(sfail), GLenum(dfail), GLenum(dpass));
+  bool changed = false;
+  if (face != Face::kBack) {
+    changed |= StateCache::Update(GL_STENCIL_FAIL, value);
+  }
+  if (face != Face::kFront) {
+    changed |= StateCache::Update(GL_STENCIL_BACK_FAIL, value);
+  }
+  if (changed) {
+    gl(StencilOpSeparate(GLenum(face), GLenum(sfail),
+                         GLenum(dfail), GLenum(dpass)));
+  }
 }
 #endif
 
@@ -3,6 +3,8 @@
 #ifndef OGLWRAP_CONTEXT_SYNCHRONIZATION_H_
 #define OGLWRAP_CONTEXT_SYNCHRONIZATION_H_
 
+#include <utility>
+
 #include "../config.h"
 #include "../enums/memory_barrier_bit.h"
 
@@ -51,6 +53,78 @@ inline void Finish() {
   gl(Finish());
 }
 
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glFenceSync) \
+    && defined(glClientWaitSync) && defined(glWaitSync) && defined(glDeleteSync))
+/**
+ * @brief A sync object that becomes signaled once all the GL commands issued
+ *        before its creation have completed.
+ *
+ * @see glFenceSync, glDeleteSync
+ * @version OpenGL 3.2
+ */
+class FenceSync {
+ public:
+  /// Inserts a new fence into the GL command stream.
+  /** @see glFenceSync */
+  FenceSync() {
+    sync_ = gl(FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+  }
+
+  /// Deletes the sync object.
+  /** @see glDeleteSync */
+  ~FenceSync() {
+    if (sync_) {
+      gl(DeleteSync(sync_));
+    }
+  }
+
+  FenceSync(FenceSync&& other) noexcept : sync_{other.sync_} {
+    other.sync_ = nullptr;
+  }
+
+  FenceSync& operator=(FenceSync&& other) noexcept {
+    std::swap(sync_, other.sync_);
+    return *this;
+  }
+
+  FenceSync(const FenceSync&) = delete;
+  FenceSync& operator=(const FenceSync&) = delete;
+
+  /**
+   * @brief Blocks the client until the fence is signaled, or the timeout
+   *        expires.
+   *
+   * @param timeout  The timeout in nanoseconds.
+   * @return True if the fence got signaled before the timeout.
+   * @see glClientWaitSync
+   */
+  bool clientWait(GLuint64 timeout = ~GLuint64(0)) const {
+    GLenum result = gl(ClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                      timeout));
+    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+  }
+
+  /// Returns true if the fence is already signaled, without blocking.
+  /** @see glClientWaitSync */
+  bool isSignaled() const {
+    GLenum result = gl(ClientWaitSync(sync_, 0, 0));
+    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+  }
+
+  /// Makes the server wait until the fence is signaled. Doesn't block the client.
+  /** @see glWaitSync */
+  void wait() const {
+    gl(WaitSync(sync_, 0, GL_TIMEOUT_IGNORED));
+  }
+
+  /// Returns the C handle for the sync object.
+  GLsync expose() const { return sync_; }
+
+ private:
+  GLsync sync_ = nullptr;
+};
+#endif  // glFenceSync && glClientWaitSync && glWaitSync && glDeleteSync
+
 } // namespace oglwrap
 
 #include "../undefine_internal_macros.h"
@@ -0,0 +1,128 @@
+// Copyright (c) Tamas Csala
+
+/** @file uniform_cache.h
+    @brief Implements a client side shadow of the programs' uniform values.
+*/
+
+#ifndef OGLWRAP_CONTEXT_UNIFORM_CACHE_H_
+#define OGLWRAP_CONTEXT_UNIFORM_CACHE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+#include "../config.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// A client side copy of the uniform values set through oglwrap.
+/** The uniform setters compare the new value to the last value set on the same
+  * (program, location) pair, and skip the glUniform* call if it's the same (the
+  * comparison is a memcmp, that compares a whole matrix at once). The getters
+  * return the cached values without calling glGetUniform*.
+  *
+  * Only single values are cached, setting an array with one call forgets the
+  * locations it writes. Linking or deleting a program forgets its values.
+  * Invalidate() has to be called after setting uniforms without oglwrap.
+  *
+  * Only used if OGLWRAP_USE_UNIFORM_CACHE is true. */
+class UniformCache {
+ public:
+  /// The size of the largest value that can be cached (a dmat4).
+  static const size_t kMaxValueSize = 16 * sizeof(double);
+
+  /// Forgets every uniform value.
+  static void Invalidate() {
+    GetInstanceSingleton().values_.clear();
+  }
+
+  /// Forgets every uniform value of a program.
+  static void Forget(GLuint program) {
+    auto& values = GetInstanceSingleton().values_;
+    for (auto iter = values.begin(); iter != values.end();) {
+      if (iter->first >> 32 == program) {
+        iter = values.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+  /// Forgets the values of count consecutive locations of a program.
+  static void Forget(GLuint program, GLint location, GLsizei count) {
+    auto& values = GetInstanceSingleton().values_;
+    for (GLsizei i = 0; i < count; ++i) {
+      values.erase(Key(program, location + i));
+    }
+  }
+
+  /// Records the new value of a uniform.
+  /** @param program   The handle of the program.
+    * @param location  The location of the uniform.
+    * @param data      The new value.
+    * @param size      The size of the value in bytes.
+    * @return false if the uniform already has this value, so the upload can
+    *         be skipped. Always true if OGLWRAP_USE_UNIFORM_CACHE is false. */
+  static bool Update(GLuint program, GLint location,
+                     const void *data, size_t size) {
+  #if OGLWRAP_USE_UNIFORM_CACHE
+    if (location < 0 || size > kMaxValueSize) {
+      return true;
+    }
+    Value& value = GetInstanceSingleton().values_[Key(program, location)];
+    if (value.size == size && std::memcmp(value.data, data, size) == 0) {
+      return false;
+    }
+    std::memcpy(value.data, data, size);
+    value.size = size;
+  #else
+    (void)program;
+    (void)location;
+    (void)data;
+    (void)size;
+  #endif
+    return true;
+  }
+
+  /// Copies the cached value of a uniform to data.
+  /** @return false if the value isn't known (or the cache is disabled). */
+  static bool Get(GLuint program, GLint location, void *data, size_t size) {
+  #if OGLWRAP_USE_UNIFORM_CACHE
+    auto& values = GetInstanceSingleton().values_;
+    auto iter = values.find(Key(program, location));
+    if (iter != values.end() && iter->second.size == size) {
+      std::memcpy(data, iter->second.data, size);
+      return true;
+    }
+  #else
+    (void)program;
+    (void)location;
+    (void)data;
+    (void)size;
+  #endif
+    return false;
+  }
+
+ private:
+  struct Value {
+    size_t size = 0;
+    unsigned char data[kMaxValueSize];
+  };
+
+  std::unordered_map<std::uint64_t, Value> values_;
+
+  UniformCache() = default;
+
+  static UniformCache& GetInstanceSingleton() {
+    static UniformCache instance;
+    return instance;
+  }
+
+  static std::uint64_t Key(GLuint program, GLint location) {
+    return std::uint64_t(program) << 32 | GLuint(location);
+  }
+};
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_CONTEXT_UNIFORM_CACHE_H_
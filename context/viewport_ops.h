@@ -7,6 +7,7 @@
 #include <glm/glm.hpp>
 
 #include "../config.h"
+#include "./state_cache.h"
 #include "../define_internal_macros.h"
 
 
@@ -15,13 +16,15 @@ namespace OGLWRAP_NAMESPACE_NAME {
 /// Sets the extents of the current viewport.
 /** @see glViewport */
 inline void Viewport(GLint x, GLint y, GLsizei w, GLsizei h) {
-	gl(Viewport(x, y, w, h));
+  if (StateCache::Update(GL_VIEWPORT, StateCache::Value(x, y, w, h))) {
+    gl(Viewport(x, y, w, h));
+  }
 }
 
 /// Sets the size of the current viewport starting at (0,0)
 /** @see glViewport */
 inline void Viewport(GLsizei w, GLsizei h) {
-	gl(Viewport(0, 0, w, h));
+  Viewport(0, 0, w, h);
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_VIEWPORT)
@@ -38,7 +41,9 @@ inline glm::ivec4 Viewport() {
 /// Sets the extents of the specified viewport.
 /** @see glViewportIndexedf */
 inline void Viewport(GLuint viewport, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
-	gl(ViewportIndexedf(viewport, x, y, w, h));
+  // The cache stores the integer viewports only.
+  StateCache::Forget(GL_VIEWPORT);
+  gl(ViewportIndexedf(viewport, x, y, w, h));
 }
 #endif
 
@@ -0,0 +1,7084 @@
+// Copyright (c) Tamas Csala
+// Generated by generate_GLerrors_table.py from GLerrors.txt, don't edit it manually.
+
+/** @file GLerrors_table.h
+    @brief Contains the possible errors of the OpenGL functions, sorted by the
+           function names.
+*/
+
+#ifndef OGLWRAP_DEBUG_GLERRORS_TABLE_H_
+#define OGLWRAP_DEBUG_GLERRORS_TABLE_H_
+
+#include <cstddef>
+
+#include "../config.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// The possible errors of an OpenGL function.
+struct OGLWRAP_GLErrorInfo {
+  /// The name of the function, like "glBindBuffer".
+  const char *name;
+  /// The signature of the function.
+  const char *signature;
+  /// The reasons of the errors (one line each), in the order of
+  /// GL_INVALID_ENUM, GL_INVALID_VALUE, GL_INVALID_OPERATION,
+  /// GL_STACK_OVERFLOW, GL_STACK_UNDERFLOW, GL_OUT_OF_MEMORY,
+  /// GL_INVALID_FRAMEBUFFER_OPERATION, and the additional notes.
+  const char *errors[8];
+};
+
+/// Returns the table of the OpenGL functions' errors, sorted by the names.
+/** The table is constant initialized, so it doesn't have any startup cost. */
+inline const OGLWRAP_GLErrorInfo* OGLWRAP_GLErrorTable(size_t *size) {
+  static const OGLWRAP_GLErrorInfo table[] = {
+    {
+      "glActiveShaderProgram",
+      "void glActiveShaderProgram(GLuint pipeline, GLuint program);",
+      {
+        "",
+        "",
+        "- Pipeline is not a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n- Program refers to a program object that has not been successfully linked. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glActiveTexture",
+      "void glActiveTexture(GLenum texture);",
+      {
+        "- Texture is not one of GL_TEXTUREi, where i ranges from 0 to (GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS - 1). \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glAttachShader",
+      "void glAttachShader(GLuint program, GLuint shader);",
+      {
+        "",
+        "- Either program or shader is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Shader is not a shader object.\n- Shader is already attached to program.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBeginConditionalRender",
+      "void glBeginConditionalRender(GLuint id, GLenum mode);",
+      {
+        "- Mode is not one of the accepted tokens. \n",
+        "- Id is not the name of an existing query object. \n",
+        "- GlBeginConditionalRender is called while conditional rendering is active, or if glEndConditionalRender is called while conditional rendering is inactive. \n- Id is the name of a query object with a target other than GL_SAMPLES_PASSED or GL_ANY_SAMPLES_PASSED. \n- Id is the name of a query currently in progress. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBeginQuery",
+      "void glBeginQuery(GLenum target, GLuint id);",
+      {
+        "- Target is not one of the accepted tokens. \n",
+        "",
+        "- GlBeginQuery is executed while a query object of the same target is already active. \n- GlEndQuery is executed when a query object of the same target is not active. \n- Id is 0. \n- Id is the name of an already active query object. \n- Id refers to an existing query object whose type does not does not match target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBeginQueryIndexed",
+      "void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id);",
+      {
+        "- Target is not one of the accepted tokens. \n",
+        "- Index is greater than the query target-specific maximum. \n",
+        "- GlBeginQueryIndexed is executed while a query object of the same target is already active. \n- GlEndQueryIndexed is executed when a query object of the same target is not active. \n- Id is 0. \n- Id is the name of an already active query object. \n- Id refers to an existing query object whose type does not does not match target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBeginTransformFeedback",
+      "void glBeginTransformFeedback(GLenum primitiveMode);",
+      {
+        "",
+        "",
+        "- GlBeginTransformFeedback is executed while transform feedback is active. \n- GlEndTransformFeedback is executed while transform feedback is not active. \n- _INVALID_OPERATION is generated by glDrawArrays if no geometry shader is present, transform feedback is active and mode is not one of the allowed modes. \n- _INVALID_OPERATION is generated by glDrawArrays if a geometry shader is present, transform feedback is active and the output primitive type of the geometry shader does not match the transform feedback primitiveMode. \n- _INVALID_OPERATION is generated by glEndTransformFeedback if any binding point used in transform feedback mode does not have a buffer object bound. \n- _INVALID_OPERATION is generated by glEndTransformFeedback if no binding points would be used, either because no program object is active of because the active program object has specified no varying variables to record. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindAttribLocation",
+      "void glBindAttribLocation(GLuint program, GLuint index, const GLchar *name);",
+      {
+        "",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n- Program is not a value generated by OpenGL.\n",
+        "- Name starts with the reserved prefix \"gl_\".\n- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindBuffer",
+      "void glBindBuffer(GLenum target, GLuint buffer);",
+      {
+        "- Target is not one of the allowable values. \n",
+        "- Buffer is not a name previously returned from a call to glGenBuffers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindBufferBase",
+      "void glBindBufferBase(GLenum target, GLuint index, GLuint buffer);",
+      {
+        "- Target is not GL_ATOMIC_COUNTER_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER, GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER. \n",
+        "- Index is greater than or equal to the number of target-specific indexed binding points. \n- Buffer does not have an associated data store, or if the size of that store is zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindBufferRange",
+      "void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);",
+      {
+        "- Target is not one of GL_ATOMIC_COUNTER_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER, GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER. \n",
+        "- Index is greater than or equal to the number of target-specific indexed binding points. \n- Size is less than or equal to zero, or if offset + size is greater than the value of GL_BUFFER_SIZE. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- Additional errors may be generated if offset violates any target-specific alignmemt restrictions. \n",
+      }
+    },
+    {
+      "glBindBuffersRange",
+      "void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLintptr *sizes);",
+      {
+        "- Target is not GL_ATOMIC_COUNTER_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER, GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER. \n",
+        "- _INVALID_VALUE is generated by if any value in offsets is less than zero or if any value in sizes is less than zero. \n- Any pair of values in offsets and sizes does not respectively satisfy the constraints described for those parameters for the specified target. \n",
+        "- First + count is greater than the number of target-specific indexed binding points. \n- Any value in buffers is not zero or the name of an existing buffer object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindFragDataLocation",
+      "void glBindFragDataLocation(GLuint program, GLuint colorNumber, const char * name);",
+      {
+        "",
+        "- ColorNumber is greater than or equal to GL_MAX_DRAW_BUFFERS. \n",
+        "- Name starts with the reserved gl_ prefix. \n- Program is not the name of a program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindFragDataLocationIndexed",
+      "void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const char *name);",
+      {
+        "",
+        "- ColorNumber is greater than or equal to GL_MAX_DRAW_BUFFERS. \n- ColorNumber is greater than or equal to GL_MAX_DUAL_SOURCE_DRAW_BUFFERS and index is greater than or equal to one. \n- Index is greater than one. \n",
+        "- Name starts with the reserved gl_ prefix. \n- Program is not the name of a program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindFramebuffer",
+      "void glBindFramebuffer(GLenum target, GLuint framebuffer);",
+      {
+        "- Target is not GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER or GL_FRAMEBUFFER. \n",
+        "",
+        "- Framebuffer is not zero or the name of a framebuffer previously returned from a call to glGenFramebuffers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindImageTexture",
+      "void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);",
+      {
+        "- Access or format is not one of the supported tokens. \n",
+        "- Unit greater than or equal to the value of GL_MAX_IMAGE_UNITS. \n- Texture is not the name of an existing texture object. \n- Level or layer is less than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindImageTextures",
+      "void glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures);",
+      {
+        "",
+        "",
+        "- First + count is greater than the number of image units supported by the implementation. \n- Any value in textures is not zero or the name of an existing texture object. \n- The internal format of the level zero texture image of any texture in textures is not supported. \n- The width, height, or depth of the level zero texture image of any texture in textures is zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindProgramPipeline",
+      "void glBindProgramPipeline(GLuint pipeline);",
+      {
+        "",
+        "",
+        "- Pipeline is not zero or a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindRenderbuffer",
+      "void glBindRenderbuffer(GLenum target, GLuint renderbuffer);",
+      {
+        "- Target is not GL_RENDERBUFFER. \n",
+        "",
+        "- Renderbuffer is not zero or the name of a renderbuffer previously returned from a call to glGenRenderbuffers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindSampler",
+      "void glBindSampler(GLuint unit, GLuint sampler);",
+      {
+        "",
+        "- Unit is greater than or equal to the value of GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS. \n",
+        "- Sampler is not zero or a name previously returned from a call to glGenSamplers, or if such a name has been deleted by a call to glDeleteSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindSamplers",
+      "void glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers);",
+      {
+        "",
+        "",
+        "- First + count is greater than the number of sampler units supported by the implementation. \n- Any value in samplers is not zero or the name of an existing sampler object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindTexture",
+      "void glBindTexture(GLenum target, GLuint texture);",
+      {
+        "- Target is not one of the allowable values. \n",
+        "- Target is not a name returned from a previous call to glGenTextures. \n",
+        "- Texture was previously created with a target that doesn't match that of target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindTextures",
+      "void glBindTextures(GLuint first, GLsizei count, const GLuint *textures);",
+      {
+        "",
+        "",
+        "- First + count is greater than the number of texture image units supported by the implementation. \n- Any value in textures is not zero or the name of an existing texture object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindTransformFeedback",
+      "void glBindTransformFeedback(GLenum target, GLuint id);",
+      {
+        "- Target is not GL_TRANSFORM_FEEDBACK. \n",
+        "",
+        "- The transform feedback operation is active on the currently bound transform feedback object, and that operation is not paused. \n- Id is not zero or the name of a transform feedback object returned from a previous call to glGenTransformFeedbacks, or if such a name has been deleted by glDeleteTransformFeedbacks. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindVertexArray",
+      "void glBindVertexArray(GLuint array);",
+      {
+        "",
+        "",
+        "- Array is not zero or the name of a vertex array object previously returned from a call to glGenVertexArrays. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBindVertexBuffer",
+      "void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLintptr stride);",
+      {
+        "",
+        "- Offset or stride is less than zero. \n- Buffer is not the name of an existing buffer object. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if bindingindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIB_BINDINGS. \n",
+      }
+    },
+    {
+      "glBindVertexBuffers",
+      "void glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLuintptr *offsets, const GLsizei *strides);",
+      {
+        "",
+        "- Any value in offsets or strides is negative, or if a value is stride is greater than the value of GL_MAX_VERTEX_ATTRIB_STRIDE. \n",
+        "- First + count is greater than the value of GL_MAX_VERTEX_ATTRIB_BINDINGS. \n- Any value in buffers is not zero or the name of an existing buffer object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendColor",
+      "void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendEquation",
+      "void glBlendEquation(GLenum mode);",
+      {
+        "- Mode is not one of GL_FUNC_ADD, GL_FUNC_SUBTRACT, GL_FUNC_REVERSE_SUBTRACT, GL_MAX, or GL_MIN. \n",
+        "- _INVALID_VALUE is generated by glBlendEquationi if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendEquationSeparate",
+      "void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha);",
+      {
+        "- Either modeRGB or modeAlpha is not one of GL_FUNC_ADD, GL_FUNC_SUBTRACT, GL_FUNC_REVERSE_SUBTRACT, GL_MAX, or GL_MIN. \n",
+        "- _INVALID_VALUE is generated by glBlendEquationSeparatei if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendEquationSeparatei",
+      "void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha);",
+      {
+        "- Either modeRGB or modeAlpha is not one of GL_FUNC_ADD, GL_FUNC_SUBTRACT, GL_FUNC_REVERSE_SUBTRACT, GL_MAX, or GL_MIN. \n",
+        "- _INVALID_VALUE is generated by glBlendEquationSeparatei if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendEquationi",
+      "void glBlendEquationi(GLuint buf, GLenum mode);",
+      {
+        "- Mode is not one of GL_FUNC_ADD, GL_FUNC_SUBTRACT, GL_FUNC_REVERSE_SUBTRACT, GL_MAX, or GL_MIN. \n",
+        "- _INVALID_VALUE is generated by glBlendEquationi if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendFunc",
+      "void glBlendFunc(GLenum sfactor, GLenum dfactor);",
+      {
+        "- Either sfactor or dfactor is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glBlendFunci if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendFuncSeparate",
+      "void glBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);",
+      {
+        "- Either srcRGB or dstRGB is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glBlendFuncSeparatei if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendFuncSeparatei",
+      "void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);",
+      {
+        "- Either srcRGB or dstRGB is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glBlendFuncSeparatei if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlendFunci",
+      "void glBlendFunci(GLuint buf, GLenum sfactor, GLenum dfactor);",
+      {
+        "- Either sfactor or dfactor is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glBlendFunci if buf is greater than or equal to the value of GL_MAX_DRAW_BUFFERS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glBlitFramebuffer",
+      "void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);",
+      {
+        "",
+        "",
+        "- Mask contains any of the GL_DEPTH_BUFFER_BIT or GL_STENCIL_BUFFER_BIT and filter is not GL_NEAREST. \n- Mask contains GL_COLOR_BUFFER_BIT and any of the following conditions hold: \n- Mask contains GL_DEPTH_BUFFER_BIT or GL_STENCIL_BUFFER_BIT and the source and destination depth and stencil formats do not match. \n- Filter is GL_LINEAR and the read buffer contains integer data. \n- The value of GL_SAMPLES for the read and draw buffers is not identical. \n- GL_SAMPLE_BUFFERS for both read and draw buffers greater than zero and the dimensions of the source and destination rectangles is not identical. \n",
+        "",
+        "",
+        "",
+        "- The objects bound to GL_DRAW_FRAMEBUFFER_BINDING or GL_READ_FRAMEBUFFER_BINDING are not framebuffer complete. \n",
+        "- The read buffer contains fixed-point or floating-point values and any draw buffer contains neither fixed-point nor floating-point values.\n- The read buffer contains unsigned integer values and any draw buffer does not contain unsigned integer values.\n- The read buffer contains signed integer values and any draw buffer does not contain signed integer values.\n",
+      }
+    },
+    {
+      "glBufferData",
+      "void glBufferData(GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage);",
+      {
+        "- Target is not one of the accepted buffer targets. \n- Usage is not GL_STREAM_DRAW, GL_STREAM_READ, GL_STREAM_COPY, GL_STATIC_DRAW, GL_STATIC_READ, GL_STATIC_COPY, GL_DYNAMIC_DRAW, GL_DYNAMIC_READ, or GL_DYNAMIC_COPY. \n",
+        "- Size is negative. \n",
+        "- The reserved buffer object name 0 is bound to target. \n",
+        "",
+        "",
+        "- The GL is unable to create a data store with the specified size. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glBufferStorage",
+      "void glBufferStorage(GLenum target, GLsizeiptr size, const GLvoid * data, GLbitfield flags);",
+      {
+        "- Target is not one of the accepted buffer targets. \n",
+        "- Size is less than or equal to zero. \n- Flags has any bits set other than those defined above. \n- Flags contains GL_MAP_PERSISTENT_BIT but does not contain at least one of GL_MAP_READ_BIT or GL_MAP_WRITE_BIT. \n- Flags contains GL_MAP_COHERENT_BIT, but does not also contain GL_MAP_PERSISTENT_BIT. \n",
+        "- The reserved buffer object name 0 is bound to target. \n- The GL_BUFFER_IMMUTABLE_STORAGE flag of the buffer bound to target is GL_TRUE. \n",
+        "",
+        "",
+        "- The GL is unable to create a data store with the properties requested in flags. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glBufferSubData",
+      "void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data);",
+      {
+        "- Target is not one of the accepted buffer targets. \n",
+        "- Offset or size is negative, or if together they define a region of memory that extends beyond the buffer object's allocated data store. \n",
+        "- The reserved buffer object name 0 is bound to target. \n- The buffer object being updated is mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCheckFramebufferStatus",
+      "GLenum glCheckFramebufferStatus(GLenum target);",
+      {
+        "- Target is not GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER or GL_FRAMEBUFFER. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClampColor",
+      "void glClampColor(GLenum target, GLenum clamp);",
+      {
+        "- Target is not GL_CLAMP_READ_COLOR. \n- Clamp is not GL_TRUE or GL_FALSE. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClear",
+      "void glClear(GLbitfield mask);",
+      {
+        "",
+        "- Any bit other than the three defined bits is set in mask. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferData",
+      "void glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data);",
+      {
+        "- Target not one of the generic buffer binding targets. \n- Internalformat is not a sized internal format. \n",
+        "- No buffer is bound to target. \n",
+        "- Any part of the buffer's data store is mapped with glMapBufferRange or glMapBuffer. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferSubData",
+      "void glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data);",
+      {
+        "- Target not one of the generic buffer binding targets. \n- Internalformat is not a sized internal format. \n",
+        "- No buffer is bound to target. \n- Offset or range are not multiples of the number of basic machine units per-element for the internal format specified by internalformat. \n- Offset or size is less than zero, or if offset + size is greater than the value of GL_BUFFER_SIZE for the buffer bound to target. \n",
+        "- Any part of the specified buffer range is mapped with glMapBufferRange or glMapBuffer. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferfi",
+      "void glClearBufferfi(GLenum buffer, GLint drawBuffer, GLfloat depth, GLint stencil);",
+      {
+        "- _INVALID_ENUM is generated by glClearBufferif, glClearBufferfv and glClearBufferuiv if buffer is not GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, GL_FRONT_AND_BACK, GL_DEPTH or GL_STENCIL. \n- _INVALID_ENUM is generated by glClearBufferfi if buffer is not GL_DEPTH_STENCIL. \n",
+        "- Buffer is GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, or GL_FRONT_AND_BACK and drawBuffer is greater than or equal to GL_MAX_DRAW_BUFFERS. \n- Buffer is GL_DEPTH, GL_STENCIL or GL_DEPTH_STENCIL and drawBuffer is not zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferfv",
+      "void glClearBufferfv(GLenum buffer, GLint drawBuffer, const GLfloat * value);",
+      {
+        "- _INVALID_ENUM is generated by glClearBufferif, glClearBufferfv and glClearBufferuiv if buffer is not GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, GL_FRONT_AND_BACK, GL_DEPTH or GL_STENCIL. \n- _INVALID_ENUM is generated by glClearBufferfi if buffer is not GL_DEPTH_STENCIL. \n",
+        "- Buffer is GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, or GL_FRONT_AND_BACK and drawBuffer is greater than or equal to GL_MAX_DRAW_BUFFERS. \n- Buffer is GL_DEPTH, GL_STENCIL or GL_DEPTH_STENCIL and drawBuffer is not zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferiv",
+      "void glClearBufferiv(GLenum buffer, GLint drawBuffer, const GLint * value);",
+      {
+        "- _INVALID_ENUM is generated by glClearBufferif, glClearBufferfv and glClearBufferuiv if buffer is not GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, GL_FRONT_AND_BACK, GL_DEPTH or GL_STENCIL. \n- _INVALID_ENUM is generated by glClearBufferfi if buffer is not GL_DEPTH_STENCIL. \n",
+        "- Buffer is GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, or GL_FRONT_AND_BACK and drawBuffer is greater than or equal to GL_MAX_DRAW_BUFFERS. \n- Buffer is GL_DEPTH, GL_STENCIL or GL_DEPTH_STENCIL and drawBuffer is not zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearBufferuiv",
+      "void glClearBufferuiv(GLenum buffer, GLint drawBuffer, const GLuint * value);",
+      {
+        "- _INVALID_ENUM is generated by glClearBufferif, glClearBufferfv and glClearBufferuiv if buffer is not GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, GL_FRONT_AND_BACK, GL_DEPTH or GL_STENCIL. \n- _INVALID_ENUM is generated by glClearBufferfi if buffer is not GL_DEPTH_STENCIL. \n",
+        "- Buffer is GL_COLOR, GL_FRONT, GL_BACK, GL_LEFT, GL_RIGHT, or GL_FRONT_AND_BACK and drawBuffer is greater than or equal to GL_MAX_DRAW_BUFFERS. \n- Buffer is GL_DEPTH, GL_STENCIL or GL_DEPTH_STENCIL and drawBuffer is not zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearColor",
+      "void glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearDepth",
+      "void glClearDepth(GLdouble depth);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearDepthf",
+      "void glClearDepthf(GLfloat depth);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearStencil",
+      "void glClearStencil(GLint s);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearTexImage",
+      "void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data);",
+      {
+        "",
+        "",
+        "- Texture is zero or not the name of an existing texture object. \n- Texture is a buffer texture. \n- Texture has a compressed internal format. \n- The base internal format is GL_DEPTH_COMPONENT and format is not GL_DEPTH_COMPONENT. \n- The base internal format is GL_DEPTH_STENCIL and format is not GL_DEPTH_STENCIL. \n- The base internal format is GL_STENCIL_INDEX and format is not GL_STENCIL_INDEX. \n- The base internal format is GL_RGBA and format is GL_DEPTH_COMPONENT, GL_STENCIL_INDEX, or GL_DEPTH_STENCIL. \n- The internal format is integer and format does not specify integer data. \n- The internal format is not integer and format specifies integer data. \n- The image array identified by level has not previously been defined by a call to glTexImage* or glTexStorage*. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClearTexSubImage",
+      "void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data);",
+      {
+        "",
+        "",
+        "- Texture is zero or not the name of an existing texture object. \n- Texture is a buffer texture. \n- Texture has a compressed internal format. \n- The base internal format is GL_DEPTH_COMPONENT and format is not GL_DEPTH_COMPONENT. \n- The base internal format is GL_DEPTH_STENCIL and format is not GL_DEPTH_STENCIL. \n- The base internal format is GL_STENCIL_INDEX and format is not GL_STENCIL_INDEX. \n- The base internal format is GL_RGBA and format is GL_DEPTH_COMPONENT, GL_STENCIL_INDEX, or GL_DEPTH_STENCIL. \n- The internal format is integer and format does not specify integer data. \n- The internal format is not integer and format specifies integer data. \n- The xoffset, yoffset, zoffset, width, height, and depth parameters (or combinations thereof) specify a region that falls outside the defined texture image array (including border, if any). \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glClientWaitSync",
+      "GLenum glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);",
+      {
+        "",
+        "- Sync is not the name of an existing sync object. \n- Flags contains any unsupported flag. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glColorMask",
+      "void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glColorMaski",
+      "void glColorMaski(GLuint buf, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCompileShader",
+      "void glCompileShader(GLuint shader);",
+      {
+        "",
+        "- Shader is not a value generated by OpenGL.\n",
+        "- Shader is not a shader object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCompressedTexImage1D",
+      "void glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is not a supported specific compressed internal formats, or is one of the generic compressed internal formats: GL_COMPRESSED_RED, GL_COMPRESSED_RG, GL_COMPRESSED_RGB, GL_COMPRESSED_RGBA. GL_COMPRESSED_SRGB, or GL_COMPRESSED_SRGB_ALPHA. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n- Border is not 0. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCompressedTexImage2D",
+      "void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is not one of the specific compressed internal formats: GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_SIGNED_RED_RGTC1, GL_COMPRESSED_RG_RGTC2, GL_COMPRESSED_SIGNED_RG_RGTC2. GL_COMPRESSED_RGBA_BPTC_UNORM, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_SRGB8_ETC2, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_RGBA8_ETC2_EAC, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_SIGNED_R11_EAC, GL_COMPRESSED_RG11_EAC, or GL_COMPRESSED_SIGNED_RG11_EAC. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n- Border is not 0. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCompressedTexImage3D",
+      "void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is not one of the generic compressed internal formats: GL_COMPRESSED_RED, GL_COMPRESSED_RG, GL_COMPRESSED_RGB, GL_COMPRESSED_RGBA. GL_COMPRESSED_SRGB, or GL_COMPRESSED_SRGB_ALPHA. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n- Border is not 0. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCompressedTexSubImage1D",
+      "void glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is not one of the generic compressed internal formats: GL_COMPRESSED_RED, GL_COMPRESSED_RG, GL_COMPRESSED_RGB, GL_COMPRESSED_RGBA. GL_COMPRESSED_SRGB, or GL_COMPRESSED_SRGB_ALPHA. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCompressedTexSubImage2D",
+      "void glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is of the generic compressed internal formats: GL_COMPRESSED_RED, GL_COMPRESSED_RG, GL_COMPRESSED_RGB, GL_COMPRESSED_RGBA. GL_COMPRESSED_SRGB, or GL_COMPRESSED_SRGB_ALPHA. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCompressedTexSubImage3D",
+      "void glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data);",
+      {
+        "- Internalformat is one of the generic compressed internal formats: GL_COMPRESSED_RED, GL_COMPRESSED_RG, GL_COMPRESSED_RGB, GL_COMPRESSED_RGBA. GL_COMPRESSED_SRGB, or GL_COMPRESSED_SRGB_ALPHA. \n",
+        "- ImageSize is not consistent with the format, dimensions, and contents of the specified compressed image data. \n",
+        "- Parameter combinations are not supported by the specific compressed internal format as specified in the specific texture compression extension. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "- Undefined results, including abnormal program termination, are generated if data is not encoded in a manner consistent with the extension specification defining the internal compression format. \n",
+      }
+    },
+    {
+      "glCopyBufferSubData",
+      "void glCopyBufferSubData(GLenum readtarget, GLenum writetarget, GLintptr readoffset, GLintptr writeoffset, GLsizeiptr size);",
+      {
+        "",
+        "- Any of readoffset, writeoffset or size is negative, if readoffset + size exceeds the size of the buffer object bound to readtarget or if writeoffset + size exceeds the size of the buffer object bound to writetarget. \n- The same buffer object is bound to both readtarget and writetarget and the ranges [readoffset, readoffset + size) and [writeoffset, writeoffset + size) overlap. \n",
+        "- Zero is bound to readtarget or writetarget. \n- The buffer object bound to either readtarget or writetarget is mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyImageSubData",
+      "void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth);",
+      {
+        "- Either target parameter is not GL_RENDERBUFFER, a valid non-proxy texture target other than GL_TEXTURE_BUFFER, or is one of the cubemap face selectors. \n- Target does not match the type of the object. \n",
+        "- Either name does not correspond to a valid renderbuffer or texture object according to the corresponding target parameter. \n- The specified level of either the source or destination is not a valid level for the corresponding image. \n- The dimensions of the either subregion exceeds the boundaries of the corresponding image object, or if the image format is compressed and the dimensions of the subregion fail to meet the alignment constraints of the format. \n",
+        "- The texel size of the uncompressed image is not equal to the block size of the compressed image. \n- Either object is a texture and the texture is not complete. \n- The source and destination internal formats are not compatible, or if the number of samples do not match. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyTexImage1D",
+      "void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);",
+      {
+        "- Target is not one of the allowable values. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 \342\201\242 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Internalformat is not an allowable value. \n- Width is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Border is not 0. \n",
+        "- Internalformat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32 and there is no depth buffer. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyTexImage2D",
+      "void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);",
+      {
+        "- Target is not GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP_POSITIVE_X, GL_TEXTURE_CUBE_MAP_NEGATIVE_X, GL_TEXTURE_CUBE_MAP_POSITIVE_Y, GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, GL_TEXTURE_CUBE_MAP_POSITIVE_Z, or GL_TEXTURE_CUBE_MAP_NEGATIVE_Z. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 \342\201\242 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Width is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Border is not 0. \n- Internalformat is not an accepted format. \n",
+        "- Internalformat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32 and there is no depth buffer. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyTexSubImage1D",
+      "void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);",
+      {
+        "- /target is not GL_TEXTURE_1D. \n",
+        "- Level is less than 0. \n- Level > log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Xoffset < 0 , or xoffset + width > w , where w is the GL_TEXTURE_WIDTH of the texture image being modified. \n",
+        "- The texture array has not been defined by a previous glTexImage1D or glCopyTexImage1D operation. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyTexSubImage2D",
+      "void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);",
+      {
+        "- Target is not GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP_POSITIVE_X, GL_TEXTURE_CUBE_MAP_NEGATIVE_X, GL_TEXTURE_CUBE_MAP_POSITIVE_Y, GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, GL_TEXTURE_CUBE_MAP_POSITIVE_Z, GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, or GL_TEXTURE_1D_ARRAY. \n",
+        "- Level is less than 0. \n- Level > log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Xoffset < 0 , xoffset + width > w , yoffset < 0 , or yoffset + height > 0 , where w is the GL_TEXTURE_WIDTH, h is the GL_TEXTURE_HEIGHT and of the texture image being modified. \n",
+        "- The texture array has not been defined by a previous glTexImage2D or glCopyTexImage2D operation. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCopyTexSubImage3D",
+      "void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);",
+      {
+        "- /target is not GL_TEXTURE_3D. \n",
+        "- Level is less than 0. \n- Level > log 2 \342\201\241 max , where max is the returned value of GL_MAX_3D_TEXTURE_SIZE if target is GL_TEXTURE_3D or the returned value of GL_MAX_ARRAY_TEXTURE_LAYERS if target is GL_TEXTURE_2D_ARRAY. \n- Xoffset < 0 , xoffset + width > w , yoffset < 0 , yoffset + height > h , zoffset < 0 , or zoffset + 1 > d , where w is the GL_TEXTURE_WIDTH, h is the GL_TEXTURE_HEIGHT, d is the GL_TEXTURE_DEPTH and of the texture image being modified. Note that w, h, and d include twice the border width. \n",
+        "- The texture array has not been defined by a previous glTexImage3D operation. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glCreateProgram",
+      "GLuint glCreateProgram(void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- This function returns 0 if an error occurs creating the program object.\n",
+      }
+    },
+    {
+      "glCreateShader",
+      "GLuint glCreateShader(GLenum shaderType);",
+      {
+        "- ShaderType is not an accepted value.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- This function returns 0 if an error occurs creating the shader object.\n",
+      }
+    },
+    {
+      "glCreateShaderProgramv",
+      "GLuint glCreateShaderProgramv(GLenum type, GLsizei count, const char **strings);",
+      {
+        "- If type is not an accepted shader type. \n",
+        "- Count is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- Other errors are generated if the supplied shader code fails to compile and link, as described for the commands in the pseudocode sequence above, but all such errors are generated without any side effects of executing those commands. \n",
+      }
+    },
+    {
+      "glCullFace",
+      "void glCullFace(GLenum mode);",
+      {
+        "- Mode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDebugMessageCallback",
+      "void glDebugMessageCallback(DEBUGPROC callback, void * userParam);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDebugMessageControl",
+      "void glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled);",
+      {
+        "- Any of source, type or severity is not one of the accepted interface types. \n",
+        "- Count is negative. \n",
+        "- Count is non-zero and either source or type is GL_DONT_CARE or if severity is not GL_DONT_CARE. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDebugMessageInsert",
+      "void glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const char *message);",
+      {
+        "- Any of source, type or severity is not one of the accepted interface types. \n",
+        "- The length of the message is greater than the value of GL_MAX_DEBUG_MESSAGE_LENGTH. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteBuffers",
+      "void glDeleteBuffers(GLsizei n, const GLuint * buffers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteFramebuffers",
+      "void glDeleteFramebuffers(GLsizei n, GLuint *framebuffers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteProgram",
+      "void glDeleteProgram(GLuint program);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteProgramPipelines",
+      "void glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteQueries",
+      "void glDeleteQueries(GLsizei n, const GLuint * ids);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteRenderbuffers",
+      "void glDeleteRenderbuffers(GLsizei n, GLuint *renderbuffers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteSamplers",
+      "void glDeleteSamplers(GLsizei n, const GLuint * samplers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteShader",
+      "void glDeleteShader(GLuint shader);",
+      {
+        "",
+        "- Shader is not a value generated by OpenGL.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteSync",
+      "void glDeleteSync(GLsync sync);",
+      {
+        "",
+        "- Sync is neither zero or the name of a sync object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteTextures",
+      "void glDeleteTextures(GLsizei n, const GLuint * textures);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteTransformFeedbacks",
+      "void glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDeleteVertexArrays",
+      "void glDeleteVertexArrays(GLsizei n, const GLuint *arrays);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthFunc",
+      "void glDepthFunc(GLenum func);",
+      {
+        "- Func is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthMask",
+      "void glDepthMask(GLboolean flag);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthRange",
+      "void glDepthRange(GLdouble nearVal, GLdouble farVal);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthRangeArrayv",
+      "void glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v);",
+      {
+        "",
+        "- First is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- First + count is greater than or equal to the value of GL_MAX_VIEWPORTS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthRangeIndexed",
+      "void glDepthRangeIndexed(GLuint index, GLdouble nearVal, GLdouble farVal);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VIEWPORTS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDepthRangef",
+      "void glDepthRangef(GLfloat nearVal, GLfloat farVal);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDetachShader",
+      "void glDetachShader(GLuint program, GLuint shader);",
+      {
+        "",
+        "- Either program or shader is a value that was not generated by OpenGL.\n",
+        "- Program is not a program object.\n- Shader is not a shader object.\n- Shader is not attached to program.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDisable",
+      "void glDisable(GLenum cap);",
+      {
+        "- Cap is not one of the values listed previously. \n",
+        "- _INVALID_VALUE is generated by glEnablei and glDisablei if index is greater than or equal to the number of indexed capabilities for cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDisableVertexAttribArray",
+      "void glDisableVertexAttribArray(GLuint index);",
+      {
+        "",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDisablei",
+      "void glDisablei(GLenum cap, GLuint index);",
+      {
+        "- Cap is not one of the values listed previously. \n",
+        "- _INVALID_VALUE is generated by glEnablei and glDisablei if index is greater than or equal to the number of indexed capabilities for cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDispatchCompute",
+      "void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);",
+      {
+        "",
+        "- Any of num_groups_x, num_groups_y, or num_groups_z is greater than or equal to the maximum work-group count for the corresponding dimension. \n",
+        "- There is no active program for the compute shader stage. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDispatchComputeIndirect",
+      "void glDispatchComputeIndirect(GLintptr indirect);",
+      {
+        "",
+        "- Indirect is less than zero or not a multiple of four. \n",
+        "- There is no active program for the compute shader stage. \n- No buffer is bound to the GL_DISPATCH_INDIRECT_BUFFER target or if the command would source data beyond the end of the buffer object's data store. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawArrays",
+      "void glDrawArrays(GLenum mode, GLint first, GLsizei count);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count is negative. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawArraysIndirect",
+      "void glDrawArraysIndirect(GLenum mode, const void *indirect);",
+      {
+        "- Mode is not an accepted value. \n",
+        "",
+        "- A non-zero buffer object name is bound to an enabled array or to the GL_DRAW_INDIRECT_BUFFER binding and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawArraysInstanced",
+      "void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei primcount);",
+      {
+        "- Mode is not one of the accepted values. \n",
+        "- Count or primcount are negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawArraysInstancedBaseInstance",
+      "void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei primcount, GLuint baseinstance);",
+      {
+        "- Mode is not one of the accepted values. \n",
+        "- Count or primcount are negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawBuffer",
+      "void glDrawBuffer(GLenum mode);",
+      {
+        "- Mode is not an accepted value. \n",
+        "",
+        "- None of the buffers indicated by mode exists. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawBuffers",
+      "void glDrawBuffers(GLsizei n, const GLenum *bufs);",
+      {
+        "- One of the values in bufs is not an accepted value.\n- The GL is bound to the default framebuffer and one or more of the values in bufs is one of the GL_COLOR_ATTACHMENTn tokens.\n- The GL is bound to a framebuffer object and one or more of the values in bufs is anything other than GL_NONE or one of the GL_COLOR_ATTACHMENTn tokens.\n- N is less than 0.\n",
+        "- N is greater than GL_MAX_DRAW_BUFFERS.\n",
+        "- A symbolic constant other than GL_NONE appears more than once in bufs.\n- Any of the entries in bufs (other than GL_NONE ) indicates a color buffer that does not exist in the current GL context.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElements",
+      "void glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count is negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsBaseVertex",
+      "void glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, GLvoid *indices, GLint basevertex);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count is negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsIndirect",
+      "void glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect);",
+      {
+        "- Mode is not an accepted value. \n",
+        "",
+        "- No buffer is bound to the GL_ELEMENT_ARRAY_BUFFER binding, or if such a buffer's data store is currently mapped. \n- A non-zero buffer object name is bound to an enabled array or to the GL_DRAW_INDIRECT_BUFFER binding and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsInstanced",
+      "void glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei primcount);",
+      {
+        "- Mode is not one of GL_POINTS, GL_LINE_STRIP, GL_LINE_LOOP, GL_LINES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, or GL_TRIANGLES. \n",
+        "- Count or primcount are negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsInstancedBaseInstance",
+      "void glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei primcount, GLuitn baseinstance);",
+      {
+        "- Mode is not one of GL_POINTS, GL_LINE_STRIP, GL_LINE_LOOP, GL_LINES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, or GL_TRIANGLES. \n",
+        "- Count or primcount are negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsInstancedBaseVertex",
+      "void glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, GLvoid *indices, GLsizei primcount, GLint basevertex);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count or primcount is negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawElementsInstancedBaseVertexBaseInstance",
+      "void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, GLvoid *indices, GLsizei primcount, GLint basevertex, GLuint baseinstance);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count or primcount is negative. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawRangeElements",
+      "void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count is negative. \n- End < start . \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "- It is an error for indices to lie outside the range start end , but implementations may not check for this situation. Such indices cause implementation-dependent behavior. \n",
+      }
+    },
+    {
+      "glDrawRangeElementsBaseVertex",
+      "void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, GLvoid *indices, GLint basevertex);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Count is negative. \n- End < start. \n",
+        "- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawTransformFeedback",
+      "void glDrawTransformFeedback(GLenum mode, GLuint id);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Id is not the name of a transform feedback object. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n- GlEndTransformFeedback has never been called while the transform feedback object named by id was bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawTransformFeedbackInstanced",
+      "void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei primcount);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Id is not the name of a transform feedback object. \n- Stream is greater than or equal to the value of GL_MAX_VERTEX_STREAMS. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n- GlEndTransformFeedback has never been called while the transform feedback object named by id was bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawTransformFeedbackStream",
+      "void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Id is not the name of a transform feedback object. \n- Stream is greater than or equal to the value of GL_MAX_VERTEX_STREAMS. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n- GlEndTransformFeedback has never been called while the transform feedback object named by id was bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glDrawTransformFeedbackStreamInstanced",
+      "void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei primcount);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Id is not the name of a transform feedback object. \n- Stream is greater than or equal to the value of GL_MAX_VERTEX_STREAMS. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n- GlEndTransformFeedback has never been called while the transform feedback object named by id was bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEnable",
+      "void glEnable(GLenum cap);",
+      {
+        "- Cap is not one of the values listed previously. \n",
+        "- _INVALID_VALUE is generated by glEnablei and glDisablei if index is greater than or equal to the number of indexed capabilities for cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEnableVertexAttribArray",
+      "void glEnableVertexAttribArray(GLuint index);",
+      {
+        "",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEnablei",
+      "void glEnablei(GLenum cap, GLuint index);",
+      {
+        "- Cap is not one of the values listed previously. \n",
+        "- _INVALID_VALUE is generated by glEnablei and glDisablei if index is greater than or equal to the number of indexed capabilities for cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEndConditionalRender",
+      "void glEndConditionalRender(void);",
+      {
+        "- Mode is not one of the accepted tokens. \n",
+        "- Id is not the name of an existing query object. \n",
+        "- GlBeginConditionalRender is called while conditional rendering is active, or if glEndConditionalRender is called while conditional rendering is inactive. \n- Id is the name of a query object with a target other than GL_SAMPLES_PASSED or GL_ANY_SAMPLES_PASSED. \n- Id is the name of a query currently in progress. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEndQuery",
+      "void glEndQuery(GLenum target);",
+      {
+        "- Target is not one of the accepted tokens. \n",
+        "",
+        "- GlBeginQuery is executed while a query object of the same target is already active. \n- GlEndQuery is executed when a query object of the same target is not active. \n- Id is 0. \n- Id is the name of an already active query object. \n- Id refers to an existing query object whose type does not does not match target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEndQueryIndexed",
+      "void glEndQueryIndexed(GLenum target, GLuint index);",
+      {
+        "- Target is not one of the accepted tokens. \n",
+        "- Index is greater than the query target-specific maximum. \n",
+        "- GlBeginQueryIndexed is executed while a query object of the same target is already active. \n- GlEndQueryIndexed is executed when a query object of the same target is not active. \n- Id is 0. \n- Id is the name of an already active query object. \n- Id refers to an existing query object whose type does not does not match target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glEndTransformFeedback",
+      "void glEndTransformFeedback(void);",
+      {
+        "",
+        "",
+        "- GlBeginTransformFeedback is executed while transform feedback is active. \n- GlEndTransformFeedback is executed while transform feedback is not active. \n- _INVALID_OPERATION is generated by glDrawArrays if no geometry shader is present, transform feedback is active and mode is not one of the allowed modes. \n- _INVALID_OPERATION is generated by glDrawArrays if a geometry shader is present, transform feedback is active and the output primitive type of the geometry shader does not match the transform feedback primitiveMode. \n- _INVALID_OPERATION is generated by glEndTransformFeedback if any binding point used in transform feedback mode does not have a buffer object bound. \n- _INVALID_OPERATION is generated by glEndTransformFeedback if no binding points would be used, either because no program object is active of because the active program object has specified no varying variables to record. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFenceSync",
+      "GLsync glFenceSync(GLenum condition, GLbitfield flags);",
+      {
+        "- Condition is not GL_SYNC_GPU_COMMANDS_COMPLETE. \n",
+        "- Flags is not zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- Additionally, if glFenceSync fails, it will return zero. \n",
+      }
+    },
+    {
+      "glFinish",
+      "void glFinish( void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFlush",
+      "void glFlush( void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFlushMappedBufferRange",
+      "void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length);",
+      {
+        "",
+        "- Offset or length is negative, or if offset + length exceeds the size of the mapping. \n",
+        "- Zero is bound to target. \n- The buffer bound to target is not mapped, or is mapped without the GL_MAP_FLUSH_EXPLICIT_BIT flag. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferParameteri",
+      "void glFramebufferParameteri(GLenum target, GLenum pname, GLint param);",
+      {
+        "- Target is not one of the accepted framebuffer targets. \n",
+        "",
+        "- The default framebuffer is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if pname is GL_FRAMEBUFFER_DEFAULT_WIDTH and param is less than zero or greater than the value of GL_MAX_FRAMEBUFFER_WIDTH. \n- GL_INVAILD_VALUE is generated if pname is GL_FRAMEBUFFER_DEFAULT_HEIGHT and param is less than zero or greater than the value of GL_MAX_FRAMEBUFFER_HEIGHT. \n- GL_INVAILD_VALUE is generated if pname is GL_FRAMEBUFFER_DEFAULT_LAYERS and param is less than zero or greater than the value of GL_MAX_FRAMEBUFFER_LAYERS. \n- GL_INVAILD_VALUE is generated if pname is GL_FRAMEBUFFER_DEFAULT_SAMPLES and param is less than zero or greater than the value of GL_MAX_FRAMEBUFFER_SAMPLES. \n",
+      }
+    },
+    {
+      "glFramebufferRenderbuffer",
+      "void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);",
+      {
+        "- Target is not one of the accepted tokens. \n- Renderbuffertarget is not GL_RENDERBUFFER. \n",
+        "",
+        "- Zero is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferTexture",
+      "void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level);",
+      {
+        "- Target is not one of the accepted tokens. \n- Renderbuffertarget is not GL_RENDERBUFFER. \n",
+        "",
+        "- Zero is bound to target. \n- Textarget and texture are not compatible. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferTexture1D",
+      "void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);",
+      {
+        "- Target is not one of the accepted tokens. \n- Renderbuffertarget is not GL_RENDERBUFFER. \n",
+        "",
+        "- Zero is bound to target. \n- Textarget and texture are not compatible. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferTexture2D",
+      "void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);",
+      {
+        "- Target is not one of the accepted tokens. \n- Renderbuffertarget is not GL_RENDERBUFFER. \n",
+        "",
+        "- Zero is bound to target. \n- Textarget and texture are not compatible. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferTexture3D",
+      "void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint layer);",
+      {
+        "- Target is not one of the accepted tokens. \n- Renderbuffertarget is not GL_RENDERBUFFER. \n",
+        "",
+        "- Zero is bound to target. \n- Textarget and texture are not compatible. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFramebufferTextureLayer",
+      "void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);",
+      {
+        "- Target is not one of the accepted tokens. \n- Attachment is not one of the accepted tokens. \n",
+        "- Texture is not zero or the name of an existing texture object. \n- Texture is not zero and layer is negative. \n",
+        "- Zero is bound to target. \n- Texture is not zero or the name of an existing cube map texture. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glFrontFace",
+      "void glFrontFace(GLenum mode);",
+      {
+        "- Mode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenBuffers",
+      "void glGenBuffers(GLsizei n, GLuint * buffers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenFramebuffers",
+      "void glGenFramebuffers(GLsizei n, GLuint *ids);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenProgramPipelines",
+      "void glGenProgramPipelines(GLsizei n, GLuint *pipelines);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenQueries",
+      "void glGenQueries(GLsizei n, GLuint * ids);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenRenderbuffers",
+      "void glGenRenderbuffers(GLsizei n, GLuint *renderbuffers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenSamplers",
+      "void glGenSamplers(GLsizei n, GLuint *samplers);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenTextures",
+      "void glGenTextures(GLsizei n, GLuint * textures);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenTransformFeedbacks",
+      "void glGenTransformFeedbacks(GLsizei n, GLuint *ids);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenVertexArrays",
+      "void glGenVertexArrays(GLsizei n, GLuint *arrays);",
+      {
+        "",
+        "- N is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGenerateMipmap",
+      "void glGenerateMipmap(GLenum target);",
+      {
+        "- Target is not one of the accepted texture targets. \n",
+        "",
+        "- Target is GL_TEXTURE_CUBE_MAP and the texture bound to the GL_TEXTURE_CUBE_MAP target of the active texture unit is not cube complete. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveAtomicCounterBufferiv",
+      "void glGetActiveAtomicCounterBufferiv(Gluint program, GLuint bufferIndex, GLenum pname, GLint *params);",
+      {
+        "- Pname is not one of the accepted tokens. \n",
+        "- Program is not the name of a program object for which glLinkProgram has been called in the past. \n- BufferIndex is greater than or equal to the value of GL_ACTIVE_ATOMIC_COUNTER_BUFFERS for program. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveAttrib",
+      "void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n- Index is greater than or equal to the number of active attribute variables in program.\n- BufSize is less than 0.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveSubroutineName",
+      "void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_ACTIVE_SUBROUTINES. \n- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveSubroutineUniformName",
+      "void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name);",
+      {
+        "- Shadertype or pname is not one of the accepted values. \n",
+        "- Index is greater than or equal to the value of GL_ACTIVE_SUBROUTINES. \n- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveSubroutineUniformiv",
+      "void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values);",
+      {
+        "- Shadertype or pname is not one of the accepted values. \n",
+        "- Index is greater than or equal to the value of GL_ACTIVE_SUBROUTINES. \n- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveUniform",
+      "void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n- Index is greater than or equal to the number of active uniform variables in program.\n- BufSize is less than 0.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveUniformBlockName",
+      "void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);",
+      {
+        "",
+        "- UniformBlockIndex is greater than or equal to the value of GL_ACTIVE_UNIFORM_BLOCKS or is not the index of an active uniform block in program. \n",
+        "- Program is not the name of a program object for which glLinkProgram has been called in the past. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveUniformBlockiv",
+      "void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);",
+      {
+        "- Pname is not one of the accepted tokens. \n",
+        "- UniformBlockIndex is greater than or equal to the value of GL_ACTIVE_UNIFORM_BLOCKS or is not the index of an active uniform block in program. \n",
+        "- Program is not the name of a program object for which glLinkProgram has been called in the past. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveUniformName",
+      "void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);",
+      {
+        "",
+        "- UniformIndex is greater than or equal to the value of GL_ACTIVE_UNIFORMS. \n- BufSize is negative. \n- Program is not the name of a program object for which glLinkProgram has been issued. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetActiveUniformsiv",
+      "void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);",
+      {
+        "- Pname is not an accepted token.\n",
+        "- Program is not a value generated by OpenGL.\n- UniformCount is greater than or equal to the value of GL_ACTIVE_UNIFORMS for program.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetAttachedShaders",
+      "void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n- MaxCount is less than 0.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetAttribLocation",
+      "GLint glGetAttribLocation(GLuint program, const GLchar *name);",
+      {
+        "",
+        "",
+        "- Program is not a value generated by OpenGL.\n- Program is not a program object.\n- Program has not been successfully linked.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBooleani_v",
+      "void glGetBooleani_v(GLenum pname, GLuint index, GLboolean * data);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBooleanv",
+      "void glGetBooleanv(GLenum pname, GLboolean * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBufferParameteri64v",
+      "void glGetBufferParameteri64v(GLenum target, GLenum value, GLint64 * data);",
+      {
+        "- Target or value is not an accepted value. \n",
+        "",
+        "- The reserved buffer object name 0 is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBufferParameteriv",
+      "void glGetBufferParameteriv(GLenum target, GLenum value, GLint * data);",
+      {
+        "- Target or value is not an accepted value. \n",
+        "",
+        "- The reserved buffer object name 0 is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBufferPointerv",
+      "void glGetBufferPointerv(GLenum target, GLenum pname, GLvoid ** params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "- The reserved buffer object name 0 is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetBufferSubData",
+      "void glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid * data);",
+      {
+        "- Target is not GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_PACK_BUFFER, or GL_PIXEL_UNPACK_BUFFER. \n",
+        "- Offset or size is negative, or if together they define a region of memory that extends beyond the buffer object's allocated data store. \n",
+        "- The reserved buffer object name 0 is bound to target. \n- The buffer object being queried is mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetCompressedTexImage",
+      "void glGetCompressedTexImage(GLenum target, GLint lod, GLvoid * img);",
+      {
+        "",
+        "- Lod is less than zero or greater than the maximum number of LODs permitted by the implementation. \n",
+        "- GlGetCompressedTexImage is used to retrieve a texture that is in an uncompressed internal format. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the data would be packed to the buffer object such that the memory writes required would exceed the data store size. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetDebugMessageLog",
+      "GLuint glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, Glenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog);",
+      {
+        "",
+        "- Count or bufSize is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetDoublei_v",
+      "void glGetDoublei_v(GLenum pname, GLuint index, GLdouble * data);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetDoublev",
+      "void glGetDoublev(GLenum pname, GLdouble * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetError",
+      "GLenum glGetError( void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFloati_v",
+      "void glGetFloati_v(GLenum pname, GLuint index, GLfloat * data);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFloatv",
+      "void glGetFloatv(GLenum pname, GLfloat * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFragDataIndex",
+      "GLint glGetFragDataIndex(GLuint program, const char * name);",
+      {
+        "",
+        "",
+        "- Program is not the name of a program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFragDataLocation",
+      "GLint glGetFragDataLocation(GLuint program, const char * name);",
+      {
+        "",
+        "",
+        "- Program is not the name of a program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFramebufferAttachmentParameteriv",
+      "void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params);",
+      {
+        "- Target is not one of the accepted tokens. \n- Pname is not valid for the value of GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE. \n",
+        "",
+        "- Attachment is not the accepted values for target. \n- Attachment is GL_DEPTH_STENCIL_ATTACHMENT and different objects are bound to the depth and stencil attachment points of target. \n- The value of GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE is GL_NONE and pname is not GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetFramebufferParameteriv",
+      "void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params);",
+      {
+        "- Target is not one of the accepted framebuffer targets. \n- Pname is not one of the accepted parameter names. \n",
+        "",
+        "- The default framebuffer is bound to target. \n",
+        "",
+        "",
+        "",
+        "",
+        "- params should be the address of a variable to which the client has write access otherwise undefined behavior, including process termination may occur. \n",
+      }
+    },
+    {
+      "glGetInteger64i_v",
+      "void glGetInteger64i_v(GLenum pname, GLuint index, GLint64 * data);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetInteger64v",
+      "void glGetInteger64v(GLenum pname, GLint64 * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetIntegeri_v",
+      "void glGetIntegeri_v(GLenum pname, GLuint index, GLint * data);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetIntegerv",
+      "void glGetIntegerv(GLenum pname, GLint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- _INVALID_VALUE is generated on any of glGetBooleani_v, glGetIntegeri_v, or glGetInteger64i_v if index is outside of the valid range for the indexed state target. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetInternalformati64v",
+      "void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params);",
+      {
+        "- Pname is not GL_SAMPLES or GL_NUM_SAMPLE_COUNTS. \n- Internalformat is not color-, depth-, or stencil-renderable. \n- Target is not one of GL_TEXTURE_2D_MULTISAMPLE, GL_TEXTURE_2D_MULTISAMPLE_ARRAY or GL_RENDERBUFFER. \n",
+        "- BufSize is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetInternalformativ",
+      "void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params);",
+      {
+        "- Pname is not GL_SAMPLES or GL_NUM_SAMPLE_COUNTS. \n- Internalformat is not color-, depth-, or stencil-renderable. \n- Target is not one of GL_TEXTURE_2D_MULTISAMPLE, GL_TEXTURE_2D_MULTISAMPLE_ARRAY or GL_RENDERBUFFER. \n",
+        "- BufSize is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetMultisamplefv",
+      "void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val);",
+      {
+        "- Pname is not one GL_SAMPLE_POSITION. \n",
+        "- Index is greater than or equal to the value of GL_SAMPLES. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetObjectLabel",
+      "void glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bifSize, GLsizei * length, char * label);",
+      {
+        "- Identifier is not one of the accepted object types. \n",
+        "- BufSize is zero. \n",
+        "- Name is not the name of an existing object of the type specified by identifier. \n",
+        "",
+        "",
+        "",
+        "",
+        "- If not NULL, length and label should be addresses to which the client has write access, otherwise undefined behavior, including process termination may occur. \n",
+      }
+    },
+    {
+      "glGetObjectPtrLabel",
+      "void glGetObjectPtrLabel(void * ptr, GLsizei bifSize, GLsizei * length, char * label);",
+      {
+        "- Identifier is not one of the accepted object types. \n",
+        "- Ptr is not the name of an existing sync object. \n- BufSize is zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- If not NULL, length and label should be addresses to which the client has write access, otherwise undefined behavior, including process termination may occur. \n",
+      }
+    },
+    {
+      "glGetProgramBinary",
+      "void glGetProgramBinary(GLuint program, GLsizei bufsize, GLsizei *length, GLenum *binaryFormat, void *binary);",
+      {
+        "",
+        "",
+        "- BufSize is less than the size of GL_PROGRAM_BINARY_LENGTH for program. \n- GL_LINK_STATUS for the program object is false. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramInfoLog",
+      "void glGetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei *length, GLchar *infoLog);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n- MaxLength is less than 0.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramInterfaceiv",
+      "void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params);",
+      {
+        "- Identifier is not one of the accepted object types. \n",
+        "- Program is not the name of an existing sync object. \n- BufSize is zero. \n",
+        "- Pname is GL_MAX_NAME_LENGTH and programInterface is GL_ATOMIC_COUNTER_BUFFER or GL_TRANSFORM_FEEDBACK_BUFFER, since active atomic counter and transform feedback buffer resources are not assigned name strings. \n- Pname is GL_MAX_NUM_ACTIVE_VARIABLES and programInterface is not GL_UNIFORM_BLOCK, GL_SHADER_STORAGE_BLOCK, GL_ATOMIC_COUNTER_BUFFER, or GL_TRANSFORM_FEEDBACK_BUFFER. \n",
+        "",
+        "",
+        "",
+        "",
+        "- If not NULL, length and label should be addresses to which the client has write access, otherwise undefined behavior, including process termination may occur. \n",
+      }
+    },
+    {
+      "glGetProgramPipelineInfoLog",
+      "void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog);",
+      {
+        "",
+        "",
+        "- Pipeline is not a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramPipelineiv",
+      "void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params);",
+      {
+        "- Pname is not one of the accepted values. \n",
+        "",
+        "- Pipeline is not zero or a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramResourceIndex",
+      "GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const char * name);",
+      {
+        "- ProgramInterface is not one of the accepted interface types. \n- ProgramInterface is GL_ATOMIC_COUNTER_BUFFER or GL_TRANSFORM_FEEDBACK_BUFFER, since active atomic counter and transform feedback buffer resources are not assigned name strings. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- Although not an error, GL_INVALID_INDEX is returned if name is not the name of a resource within the interface identified by programInterface. \n",
+      }
+    },
+    {
+      "glGetProgramResourceLocation",
+      "GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, const char * name);",
+      {
+        "- ProgramInterface is not one of the accepted interface types. \n",
+        "- Program is not the name of an existing program object. \n",
+        "- Program has not been linked successfully. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramResourceLocationIndex",
+      "GLint glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const char * name);",
+      {
+        "- ProgramInterface is not one of the accepted interface types. \n",
+        "- Program is not the name of an existing program object. \n",
+        "- Program has not been linked successfully. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramResourceName",
+      "void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, char * name);",
+      {
+        "- ProgramInterface is not one of the accepted interface types. \n- ProgramInterface is GL_ATOMIC_COUNTER_BUFFER or GL_TRANSFORM_FEEDBACK_BUFFER, since active atomic counter and transform feedback buffer resources are not assigned name strings. \n",
+        "- Progam is not the name of an existing program. \n- Index is greater than or equal to the number of entries in the active resource list for programInterface. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramResourceiv",
+      "void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const Glenum * props, GLsizei bufSize, GLsizei * length, GLint * params);",
+      {
+        "- ProgramInterface is not one of the accepted interface types. \n",
+        "- Program is not the name of an existing program object. \n- PropCount is zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVLALID_ENUM is generated if any value in props is not one of the accepted tokens for the interface programInterface \n",
+      }
+    },
+    {
+      "glGetProgramStageiv",
+      "void glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values);",
+      {
+        "- Shadertype or pname is not one of the accepted values. \n",
+        "- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetProgramiv",
+      "void glGetProgramiv(GLuint program, GLenum pname, GLint *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program does not refer to a program object.\n- Pname is GL_GEOMETRY_VERTICES_OUT, GL_GEOMETRY_INPUT_TYPE, or GL_GEOMETRY_OUTPUT_TYPE, and program does not contain a geometry shader.\n- Pname is GL_COMPUTE_WORK_GROUP_SIZE and program does not contain a binary for the compute shader stage.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryIndexediv",
+      "void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "- Index is greater than or equal to the target-specific maximum. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryObjecti64v",
+      "void glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "",
+        "- Id is not the name of a query object. \n- Id is the name of a currently active query object. \n- A buffer is currently bound to the GL_QUERY_RESULT_BUFFER target and the command would cause data to be written beyond the bounds of that buffer's data store. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryObjectiv",
+      "void glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "",
+        "- Id is not the name of a query object. \n- Id is the name of a currently active query object. \n- A buffer is currently bound to the GL_QUERY_RESULT_BUFFER target and the command would cause data to be written beyond the bounds of that buffer's data store. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryObjectui64v",
+      "void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "",
+        "- Id is not the name of a query object. \n- Id is the name of a currently active query object. \n- A buffer is currently bound to the GL_QUERY_RESULT_BUFFER target and the command would cause data to be written beyond the bounds of that buffer's data store. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryObjectuiv",
+      "void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "",
+        "- Id is not the name of a query object. \n- Id is the name of a currently active query object. \n- A buffer is currently bound to the GL_QUERY_RESULT_BUFFER target and the command would cause data to be written beyond the bounds of that buffer's data store. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetQueryiv",
+      "void glGetQueryiv(GLenum target, GLenum pname, GLint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetRenderbufferParameteriv",
+      "void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params);",
+      {
+        "- Pname is not one of the accepted tokens. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSamplerParameterIiv",
+      "void glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Sampler is not the name of a sampler object returned from a previous call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSamplerParameterIuiv",
+      "void glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Sampler is not the name of a sampler object returned from a previous call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSamplerParameterfv",
+      "void glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Sampler is not the name of a sampler object returned from a previous call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSamplerParameteriv",
+      "void glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Sampler is not the name of a sampler object returned from a previous call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetShaderInfoLog",
+      "void glGetShaderInfoLog(GLuint shader, GLsizei maxLength, GLsizei *length, GLchar *infoLog);",
+      {
+        "",
+        "- Shader is not a value generated by OpenGL.\n- MaxLength is less than 0.\n",
+        "- Shader is not a shader object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetShaderPrecisionFormat",
+      "void glGetShaderPrecisionFormat(GLenum shaderType, GLenum precisionType, GLint *range, GLint *precision);",
+      {
+        "- ShaderType or precisionType is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetShaderSource",
+      "void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);",
+      {
+        "",
+        "- Shader is not a value generated by OpenGL.\n- BufSize is less than 0.\n",
+        "- Shader is not a shader object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetShaderiv",
+      "void glGetShaderiv(GLuint shader, GLenum pname, GLint *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Shader is not a value generated by OpenGL.\n",
+        "- Shader does not refer to a shader object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetString",
+      "const GLubyte* glGetString(GLenum name);",
+      {
+        "- Name is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glGetStringi if index is outside the valid range for indexed state name. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetStringi",
+      "const GLubyte* glGetStringi(GLenum name, GLuint index);",
+      {
+        "- Name is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glGetStringi if index is outside the valid range for indexed state name. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSubroutineIndex",
+      "GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name);",
+      {
+        "- Shadertype or pname is not one of the accepted values. \n",
+        "- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSubroutineUniformLocation",
+      "GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name);",
+      {
+        "- Shadertype or pname is not one of the accepted values. \n",
+        "- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetSynciv",
+      "void glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);",
+      {
+        "- Pname is not one of the accepted tokens. \n",
+        "- Sync is not the name of a sync object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexImage",
+      "void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * img);",
+      {
+        "- Target, format, or type is not an accepted value. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n",
+        "- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_SHORT_5_6_5_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_5_9_9_9_REV and format is neither GL_RGBA or GL_BGRA. \n- Format is GL_STENCIL_INDEX and the base internal format is not GL_STENCIL_INDEX or GL_DEPTH_STENCIL. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the data would be packed to the buffer object such that the memory writes required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and img is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexLevelParameterfv",
+      "void glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 max, where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Target is GL_TEXTURE_BUFFER and level is not zero. \n",
+        "- GL_TEXTURE_COMPRESSED_IMAGE_SIZE is queried on texture images with an uncompressed internal format or on proxy targets. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexLevelParameteriv",
+      "void glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 max, where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Target is GL_TEXTURE_BUFFER and level is not zero. \n",
+        "- GL_TEXTURE_COMPRESSED_IMAGE_SIZE is queried on texture images with an uncompressed internal format or on proxy targets. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexParameterIiv",
+      "void glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexParameterIuiv",
+      "void glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexParameterfv",
+      "void glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTexParameteriv",
+      "void glGetTexParameteriv(GLenum target, GLenum pname, GLint * params);",
+      {
+        "- Target or pname is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetTransformFeedbackVarying",
+      "void glGetTransformFeedbackVarying(GLuintprogram, GLuintindex, GLsizeibufSize, GLsizei *length, GLsizei *size, GLenum *type, char *name);",
+      {
+        "",
+        "- Program is not the name of a program object. \n- Index is greater or equal to the value of GL_TRANSFORM_FEEDBACK_VARYINGS. \n",
+        "- _INVALID_OPERATION is generated program has not been linked. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformBlockIndex",
+      "GLuint glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName);",
+      {
+        "",
+        "",
+        "- Program is not the name of a program object for which glLinkProgram has been called in the past. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformIndices",
+      "void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar **uniformNames, GLuint *uniformIndices);",
+      {
+        "",
+        "",
+        "- Program is not the name of a program object for which glLinkProgram has been called in the past. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformLocation",
+      "GLint glGetUniformLocation(GLuint program, const GLchar *name);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program has not been successfully linked.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformSubroutineuiv",
+      "void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *values);",
+      {
+        "- Shadertype is not one of the accepted values. \n",
+        "- Location is greater than or equal to the value of GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS for the shader currently in use at shader stage shadertype. \n",
+        "- No program is active. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformdv",
+      "void glGetUniformdv(GLuint program, GLint location, GLdouble *params);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program has not been successfully linked.\n- Location does not correspond to a valid uniform variable location for the specified program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformfv",
+      "void glGetUniformfv(GLuint program, GLint location, GLfloat *params);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program has not been successfully linked.\n- Location does not correspond to a valid uniform variable location for the specified program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformiv",
+      "void glGetUniformiv(GLuint program, GLint location, GLint *params);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program has not been successfully linked.\n- Location does not correspond to a valid uniform variable location for the specified program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetUniformuiv",
+      "void glGetUniformuiv(GLuint program, GLint location, GLuint *params);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program has not been successfully linked.\n- Location does not correspond to a valid uniform variable location for the specified program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribIiv",
+      "void glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribIuiv",
+      "void glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribLdv",
+      "void glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribPointerv",
+      "void glGetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid **pointer);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- No vertex array object is currently bound.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribdv",
+      "void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribfv",
+      "void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glGetVertexAttribiv",
+      "void glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params);",
+      {
+        "- Pname is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "- Pname is not GL_CURRENT_VERTEX_ATTRIB and there is no currently bound vertex array object.\n- Index is 0 and pname is GL_CURRENT_VERTEX_ATTRIB.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glHint",
+      "void glHint(GLenum target, GLenum mode);",
+      {
+        "- Either target or mode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateBufferData",
+      "void glInvalidateBufferData(GLuint buffer);",
+      {
+        "",
+        "- Buffer is not the name of an existing buffer object. \n",
+        "- Any part of buffer is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateBufferSubData",
+      "void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length);",
+      {
+        "",
+        "- Offset or length is negative, or if offset + length is greater than the value of GL_BUFFER_SIZE for buffer. \n- Buffer is not the name of an existing buffer object. \n",
+        "- Any part of buffer is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateFramebuffer",
+      "void glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments);",
+      {
+        "- Target is not one of the accepted framebuffer target tokens. \n- Any element of attachments is not one of the accepted framebuffer attachment tokens. \n",
+        "",
+        "- Element of attachments is GL_COLOR_ATTACHMENTi where i is greater than or equal to the value of GL_MAX_COLOR_ATTACHMENTS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateSubFramebuffer",
+      "void glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLint width, GLint height);",
+      {
+        "- Target is not one of the accepted framebuffer target tokens. \n- Any element of attachments is not one of the accepted framebuffer attachment tokens. \n",
+        "",
+        "- Element of attachments is GL_COLOR_ATTACHMENTi where i is greater than or equal to the value of GL_MAX_COLOR_ATTACHMENTS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateTexImage",
+      "void glInvalidateTexImage(GLuint texture, GLint level);",
+      {
+        "",
+        "- Level is less than zero or if it is greater or equal to the base 2 logarithm of the maximum texture width, height, or depth. \n- The target of texture is any of GL_TEXTURE_RECTANGLE, GL_TEXTURE_BUFFER, GL_TEXTURE_2D_MULTISAMPLE, or GL_TEXTURE_2D_MULTISAMPLE_ARRAY and level is not zero. \n- Texture is not the name of an existing texture object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glInvalidateTexSubImage",
+      "void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth);",
+      {
+        "",
+        "- Xoffset, yoffset or zoffset is less than zero, or if any of them is greater than the size of the image in the corresponding dimension. \n- Level is less than zero or if it is greater or equal to the base 2 logarithm of the maximum texture width, height, or depth. \n- The target of texture is any of GL_TEXTURE_RECTANGLE, GL_TEXTURE_BUFFER, GL_TEXTURE_2D_MULTISAMPLE, or GL_TEXTURE_2D_MULTISAMPLE_ARRAY and level is not zero. \n- Texture is not the name of an existing texture object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsBuffer",
+      "GLboolean glIsBuffer(GLuint buffer);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsEnabled",
+      "GLboolean glIsEnabled(GLenum cap);",
+      {
+        "- Cap is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glIsEnabledi if index is outside the valid range for the indexed state cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsEnabledi",
+      "GLboolean glIsEnabledi(GLenum cap, GLuint index);",
+      {
+        "- Cap is not an accepted value. \n",
+        "- _INVALID_VALUE is generated by glIsEnabledi if index is outside the valid range for the indexed state cap. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsFramebuffer",
+      "GLboolean glIsFramebuffer(GLuint framebuffer);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsProgram",
+      "GLboolean glIsProgram(GLuint program);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsProgramPipeline",
+      "GLboolean glIsProgramPipeline(GLuint pipeline);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsQuery",
+      "GLboolean glIsQuery(GLuint id);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsRenderbuffer",
+      "GLboolean glIsRenderbuffer(GLuint renderbuffer);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsSampler",
+      "GLboolean glIsSampler(GLuint id);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsShader",
+      "GLboolean glIsShader(GLuint shader);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsSync",
+      "GLboolean glIsSync(GLsync sync);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsTexture",
+      "GLboolean glIsTexture(GLuint texture);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsTransformFeedback",
+      "GLboolean glIsTransformFeedback(GLuint id);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glIsVertexArray",
+      "GLboolean glIsVertexArray(GLuint array);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glLineWidth",
+      "void glLineWidth(GLfloat width);",
+      {
+        "",
+        "- Width is less than or equal to 0. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glLinkProgram",
+      "void glLinkProgram(GLuint program);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program is the currently active program object and transform feedback mode is active.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glLogicOp",
+      "void glLogicOp(GLenum opcode);",
+      {
+        "- Opcode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMapBuffer",
+      "void * glMapBuffer(GLenum target, GLenum access);",
+      {
+        "- Target is not one of the accepted targets. \n- Access is not GL_READ_ONLY, GL_WRITE_ONLY, or GL_READ_WRITE. \n",
+        "",
+        "- The reserved buffer object name 0 is bound to target. \n- GlMapBuffer is executed for a buffer object whose data store is already mapped. \n- GlUnmapBuffer is executed for a buffer object whose data store is not currently mapped. \n",
+        "",
+        "",
+        "- _OUT_OF_MEMORY is generated when glMapBuffer is executed if the GL is unable to map the buffer object's data store. This may occur for a variety of system-specific reasons, such as the absence of sufficient remaining virtual memory. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glMapBufferRange",
+      "void *glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);",
+      {
+        "",
+        "- Either of offset or length is negative, or if offset + length is greater than the value of GL_BUFFER_SIZE. \n- Access has any bits set other than those defined above. \n",
+        "- _INVALID_OPERATION is generated for any of the following conditions: \n",
+        "",
+        "",
+        "- GlMapBufferRange fails because memory for the mapping could not be obtained. \n",
+        "",
+        "- The buffer is already in a mapped state. \n- Neither GL_MAP_READ_BIT or GL_MAP_WRITE_BIT is set. \n- GL_MAP_READ_BIT is set and any of GL_MAP_INVALIDATE_RANGE_BIT, GL_MAP_INVALIDATE_BUFFER_BIT, or GL_MAP_UNSYNCHRONIZED_BIT is set. \n- GL_MAP_FLUSH_EXPLICIT_BIT is set and GL_MAP_WRITE_BIT is not set. \n- Any of GL_MAP_READ_BIT, GL_MAP_WRITE_BIT, GL_MAP_PERSISTENT_BIT, or GL_MAP_COHERENT_BIT are included in access, but the same bit is not included in the buffer's storage flags. \n",
+      }
+    },
+    {
+      "glMemoryBarrier",
+      "void glMemoryBarrier(GLbitfield barriers);",
+      {
+        "",
+        "- Barriers contains any unsupported bits, or is not the special value GL_ALL_BARRIER_BITS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMinSampleShading",
+      "void glMinSampleShading(GLfloat value);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "- None. \n",
+      }
+    },
+    {
+      "glMultiDrawArrays",
+      "void glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Drawcount is negative. \n",
+        "- A non-zero buffer object name is bound to an enabled array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMultiDrawArraysIndirect",
+      "void glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Stride is not a multiple of four. \n- Drawcount is negative. \n",
+        "- A non-zero buffer object name is bound to an enabled array or to the GL_DRAW_INDIRECT_BUFFER binding and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMultiDrawElements",
+      "void glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei drawcount);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Drawcount is negative. \n",
+        "- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMultiDrawElementsBaseVertex",
+      "void glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei drawcount, const GLint *basevertex);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Drawcount is negative. \n",
+        "- A non-zero buffer object name is bound to an enabled array or the element array and the buffer object's data store is currently mapped. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glMultiDrawElementsIndirect",
+      "void glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);",
+      {
+        "- Mode is not an accepted value. \n",
+        "- Stride is not a multiple of four. \n- Drawcount is negative. \n",
+        "- No buffer is bound to the GL_ELEMENT_ARRAY_BUFFER binding, or if such a buffer's data store is currently mapped. \n- A non-zero buffer object name is bound to an enabled array or to the GL_DRAW_INDIRECT_BUFFER binding and the buffer object's data store is currently mapped. \n- A geometry shader is active and mode is incompatible with the input primitive type of the geometry shader in the currently installed program object. \n- Mode is GL_PATCHES and no tessellation control shader is active. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glObjectLabel",
+      "void glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const char * label);",
+      {
+        "- Identifier is not one of the accepted object types. \n",
+        "- The number of characters in label, excluding the null terminator when length is negative, is greater than the value of GL_MAX_LABEL_LENGTH. \n",
+        "- Name is not the name of an existing object of the type specified by identifier. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glObjectPtrLabel",
+      "void glObjectPtrLabel(void * ptr, GLsizei length, const char * label);",
+      {
+        "",
+        "- Ptr is not a valid sync object. \n- The number of characters in label, excluding the null terminator when length is negative, is greater than the value of GL_MAX_LABEL_LENGTH. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPatchParameterfv",
+      "void glPatchParameterfv(GLenum pname, const GLfloat *values);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Pname is GL_PATCH_VERTICES and value is less than or equal to zero, or greater than the value of GL_MAX_PATCH_VERTICES. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPatchParameteri",
+      "void glPatchParameteri(GLenum pname, GLint value);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- Pname is GL_PATCH_VERTICES and value is less than or equal to zero, or greater than the value of GL_MAX_PATCH_VERTICES. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPauseTransformFeedback",
+      "void glPauseTransformFeedback(void);",
+      {
+        "",
+        "",
+        "- The currently bound transform feedback object is not active or is paused. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPixelStoref",
+      "void glPixelStoref(GLenum pname, GLfloat param);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- A negative row length, pixel skip, or row skip value is specified, or if alignment is specified as other than 1, 2, 4, or 8. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPixelStorei",
+      "void glPixelStorei(GLenum pname, GLint param);",
+      {
+        "- Pname is not an accepted value. \n",
+        "- A negative row length, pixel skip, or row skip value is specified, or if alignment is specified as other than 1, 2, 4, or 8. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPointParameterf",
+      "void glPointParameterf(GLenum pname, GLfloat param);",
+      {
+        "- _INVALID_ENUM is generated If the value specified for GL_POINT_SPRITE_COORD_ORIGIN is not GL_LOWER_LEFT or GL_UPPER_LEFT. \n",
+        "- The value specified for GL_POINT_FADE_THRESHOLD_SIZE is less than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPointParameterfv",
+      "void glPointParameterfv(GLenum pname, const GLfloat * params);",
+      {
+        "- _INVALID_ENUM is generated If the value specified for GL_POINT_SPRITE_COORD_ORIGIN is not GL_LOWER_LEFT or GL_UPPER_LEFT. \n",
+        "- The value specified for GL_POINT_FADE_THRESHOLD_SIZE is less than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPointParameteri",
+      "void glPointParameteri(GLenum pname, GLint param);",
+      {
+        "- _INVALID_ENUM is generated If the value specified for GL_POINT_SPRITE_COORD_ORIGIN is not GL_LOWER_LEFT or GL_UPPER_LEFT. \n",
+        "- The value specified for GL_POINT_FADE_THRESHOLD_SIZE is less than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPointParameteriv",
+      "void glPointParameteriv(GLenum pname, const GLint * params);",
+      {
+        "- _INVALID_ENUM is generated If the value specified for GL_POINT_SPRITE_COORD_ORIGIN is not GL_LOWER_LEFT or GL_UPPER_LEFT. \n",
+        "- The value specified for GL_POINT_FADE_THRESHOLD_SIZE is less than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPointSize",
+      "void glPointSize(GLfloat size);",
+      {
+        "",
+        "- Size is less than or equal to 0. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPolygonMode",
+      "void glPolygonMode(GLenum face, GLenum mode);",
+      {
+        "- Either face or mode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPolygonOffset",
+      "void glPolygonOffset(GLfloat factor, GLfloat units);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPopDebugGroup",
+      "void glPopDebugGroup(void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "- An attempt is made to pop the default debug group from the stack. \n",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPrimitiveRestartIndex",
+      "void glPrimitiveRestartIndex(GLuint index);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramBinary",
+      "void glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);",
+      {
+        "- BinaryFormat is not a value recognized by the implementation. \n",
+        "",
+        "- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramParameteri",
+      "void glProgramParameteri(GLuint program, GLenum pname, GLint value);",
+      {
+        "- Pname is not one of the accepted values. \n",
+        "- Value is not a valid value for the parameter named by pname. \n",
+        "- Program is not the name of an existing program object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1f",
+      "void glProgramUniform1f(GLuint program, GLint location, GLfloat v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1fv",
+      "void glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1i",
+      "void glProgramUniform1i(GLuint program, GLint location, GLint v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1iv",
+      "void glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1ui",
+      "void glProgramUniform1ui(GLuint program, GLint location, GLuint v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform1uiv",
+      "void glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2f",
+      "void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2fv",
+      "void glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2i",
+      "void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2iv",
+      "void glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2ui",
+      "void glProgramUniform2ui(GLuint program, GLint location, GLint v0, GLuint v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform2uiv",
+      "void glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3f",
+      "void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3fv",
+      "void glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3i",
+      "void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3iv",
+      "void glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3ui",
+      "void glProgramUniform3ui(GLuint program, GLint location, GLint v0, GLint v1, GLuint v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform3uiv",
+      "void glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4f",
+      "void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4fv",
+      "void glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4i",
+      "void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4iv",
+      "void glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4ui",
+      "void glProgramUniform4ui(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLuint v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniform4uiv",
+      "void glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix2fv",
+      "void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix2x3fv",
+      "void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix2x4fv",
+      "void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix3fv",
+      "void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix3x2fv",
+      "void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix3x4fv",
+      "void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix4fv",
+      "void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix4x2fv",
+      "void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProgramUniformMatrix4x3fv",
+      "void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- Program does not refer to a program object owned by the GL.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glProgramUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for program and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glProgramUniform1i and glProgramUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glProvokingVertex",
+      "void glProvokingVertex(GLenum provokeMode);",
+      {
+        "- ProvokeMode is not an accepted value. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glPushDebugGroup",
+      "void glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const char * message);",
+      {
+        "- The value of source is neither GL_DEBUG_SOURCE_APPLICATION nor GL_DEBUG_SOURCE_THIRD_PARTY. \n",
+        "- Length is negative and the number of characters in message, excluding the null-terminator, is not less than the value of GL_MAX_DEBUG_MESSAGE_LENGTH. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glQueryCounter",
+      "void glQueryCounter(GLuint id, GLenum target);",
+      {
+        "- Target is not GL_TIMESTAMP. \n",
+        "- Id is not the name of a query object returned from a previous call to glGenQueries. \n",
+        "- Id is the name of a query object that is already in use within a glBeginQuery / glEndQuery block. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glReadBuffer",
+      "void glReadBuffer(GLenum mode);",
+      {
+        "- Mode is not one of the twelve (or more) accepted values. \n",
+        "",
+        "- Mode specifies a buffer that does not exist. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glReadPixels",
+      "void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * data);",
+      {
+        "- Format or type is not an accepted value. \n- Format is GL_DEPTH_STENCIL and type is not GL_UNSIGNED_INT_24_8 or GL_FLOAT_32_UNSIGNED_INT_24_8_REV. \n",
+        "- Either width or height is negative. \n",
+        "- Format is GL_STENCIL_INDEX and there is no stencil buffer. \n- Format is GL_DEPTH_COMPONENT and there is no depth buffer. \n- Format is GL_DEPTH_STENCIL and there is no depth buffer or if there is no stencil buffer. \n- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and the data would be packed to the buffer object such that the memory writes required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_PACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n- GL_READ_FRAMEBUFFER_BINDING is non-zero, the read framebuffer is complete, and the value of GL_SAMPLE_BUFFERS for the read framebuffer is greater than zero. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glReleaseShaderCompiler",
+      "void glReleaseShaderCompiler(void);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glRenderbufferStorage",
+      "void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);",
+      {
+        "- Target is not GL_RENDERBUFFER. \n- Internalformat is not a color-renderable, depth-renderable, or stencil-renderable format. \n",
+        "- Either of width or height is negative, or greater than the value of GL_MAX_RENDERBUFFER_SIZE. \n",
+        "",
+        "",
+        "",
+        "- The GL is unable to create a data store of the requested size. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glRenderbufferStorageMultisample",
+      "void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);",
+      {
+        "- Target is not GL_RENDERBUFFER. \n- Internalformat is not a color-renderable, depth-renderable, or stencil-renderable format. \n",
+        "- Samples is greater than GL_MAX_SAMPLES. \n- Either of width or height is negative, or greater than the value of GL_MAX_RENDERBUFFER_SIZE. \n",
+        "- Internalformat is a signed or unsigned integer format and samples is greater than the value of GL_MAX_INTEGER_SAMPLES \n",
+        "",
+        "",
+        "- The GL is unable to create a data store of the requested size. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glResumeTransformFeedback",
+      "void glResumeTransformFeedback(void);",
+      {
+        "",
+        "",
+        "- The currently bound transform feedback object is not active or is not paused. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSampleCoverage",
+      "void glSampleCoverage(GLfloat value, GLboolean invert);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSampleMaski",
+      "void glSampleMaski(GLuint maskNumber, GLbitfield mask);",
+      {
+        "",
+        "- MaskIndex is greater than or equal to the value of GL_MAX_SAMPLE_MASK_WORDS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameterIiv",
+      "void glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *params);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameterIuiv",
+      "void glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *params);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameterf",
+      "void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameterfv",
+      "void glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * params);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameteri",
+      "void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glSamplerParameteriv",
+      "void glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * params);",
+      {
+        "- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "- Sampler is not the name of a sampler object previously returned from a call to glGenSamplers. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glScissor",
+      "void glScissor(GLint x, GLint y, GLsizei width, GLsizei height);",
+      {
+        "",
+        "- Either width or height is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glScissorArrayv",
+      "void glScissorArrayv(GLuint first, GLsizei count, const GLint *v);",
+      {
+        "",
+        "- First is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- First + count is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Any width or height specified in the array v is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glScissorIndexed",
+      "void glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Any width or height specified in the array v is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glScissorIndexedv",
+      "void glScissorIndexedv(GLuint index, const GLint *v);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Any width or height specified in the array v is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glShaderBinary",
+      "void glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length);",
+      {
+        "- BinaryFormat is not an accepted value. \n",
+        "- The data pointed to by binary does not match the format specified by binaryFormat. \n",
+        "- More than one of the handles in shaders refers to the same shader object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glShaderSource",
+      "void glShaderSource(GLuint shader, GLsizei count, const GLchar **string, const GLint *length);",
+      {
+        "",
+        "- Shader is not a value generated by OpenGL.\n- Count is less than 0.\n",
+        "- Shader is not a shader object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glShaderStorageBlockBinding",
+      "void glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding);",
+      {
+        "",
+        "- Attribindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if bindingindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIB_BINDINGS. \n",
+      }
+    },
+    {
+      "glStencilFunc",
+      "void glStencilFunc(GLenum func, GLint ref, GLuint mask);",
+      {
+        "- Func is not one of the eight accepted values. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glStencilFuncSeparate",
+      "void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask);",
+      {
+        "- Func is not one of the eight accepted values. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glStencilMask",
+      "void glStencilMask(GLuint mask);",
+      {
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glStencilMaskSeparate",
+      "void glStencilMaskSeparate(GLenum face, GLuint mask);",
+      {
+        "- Face is not one of the accepted tokens. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glStencilOp",
+      "void glStencilOp(GLenum sfail, GLenum dpfail, GLenum dppass);",
+      {
+        "- Sfail, dpfail, or dppass is any value other than the defined constant values. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glStencilOpSeparate",
+      "void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);",
+      {
+        "- Face is any value other than GL_FRONT, GL_BACK, or GL_FRONT_AND_BACK. \n- Sfail, dpfail, or dppass is any value other than the eight defined constant values. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexBuffer",
+      "void glTexBuffer(GLenum target, GLenum internalFormat, GLuint buffer);",
+      {
+        "- Target is not GL_TEXTURE_BUFFER. \n- InternalFormat is not one of the accepted tokens. \n",
+        "",
+        "- Buffer is not zero or the name of an existing buffer object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexBufferRange",
+      "void glTexBufferRange(GLenum target, GLenum internalFormat, GLuint buffer, GLintptr offset, GLsizeiptr size);",
+      {
+        "- Target is not GL_TEXTURE_BUFFER. \n",
+        "- Offset is less than zero. \n- Size is less than or equal to zero. \n- Offset + size is greater than the value of GL_BUFFER_SIZE for buffer. \n- Offset is not an integer multiple of the value of GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexImage1D",
+      "void glTexImage1D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- Target is not GL_TEXTURE_1D or GL_PROXY_TEXTURE_1D. \n- Format is not an accepted format constant. Format constants other than GL_STENCIL_INDEX are accepted. \n- Type is not a type constant. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- InternalFormat is not one of the accepted resolution and format symbolic constants. \n- Width is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Border is not 0. \n",
+        "- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- Format is GL_DEPTH_COMPONENT and internalFormat is not GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32. \n- InternalFormat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32, and format is not GL_DEPTH_COMPONENT. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexImage2D",
+      "void glTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- Target is not GL_TEXTURE_2D, GL_TEXTURE_1D_ARRAY, GL_TEXTURE_RECTANGLE, GL_PROXY_TEXTURE_2D, GL_PROXY_TEXTURE_1D_ARRAY, GL_PROXY_TEXTURE_RECTANGLE, GL_PROXY_TEXTURE_CUBE_MAP, GL_TEXTURE_CUBE_MAP_POSITIVE_X, GL_TEXTURE_CUBE_MAP_NEGATIVE_X, GL_TEXTURE_CUBE_MAP_POSITIVE_Y, GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, GL_TEXTURE_CUBE_MAP_POSITIVE_Z, or GL_TEXTURE_CUBE_MAP_NEGATIVE_Z. \n- Target is one of the six cube map 2D image targets and the width and height parameters are not equal. \n- Type is not a type constant. \n",
+        "- Width is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Target is not GL_TEXTURE_1D_ARRAY or GL_PROXY_TEXTURE_1D_ARRAY and height is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Target is GL_TEXTURE_1D_ARRAY or GL_PROXY_TEXTURE_1D_ARRAY and height is less than 0 or greater than GL_MAX_ARRAY_TEXTURE_LAYERS. \n- Level is less than 0. \n- Level is greater than log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- InternalFormat is not one of the accepted resolution and format symbolic constants. \n- Width or height is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Border is not 0. \n- Target is GL_TEXTURE_RECTANGLE or GL_PROXY_TEXTURE_RECTANGLE and level is not 0. \n",
+        "- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_SHORT_5_6_5_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV, and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_5_9_9_9_REV, and format is neither GL_RGBA nor GL_BGRA. \n- Target is not GL_TEXTURE_2D, GL_PROXY_TEXTURE_2D, GL_TEXTURE_RECTANGLE, or GL_PROXY_TEXTURE_RECTANGLE, and internalFormat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32F. \n- Format is GL_DEPTH_COMPONENT and internalFormat is not GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32F. \n- InternalFormat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32F, and format is not GL_DEPTH_COMPONENT. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexImage2DMultisample",
+      "void glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);",
+      {
+        "",
+        "- Either width or height negative or is greater than GL_MAX_TEXTURE_SIZE. \n- Samples is greater than GL_MAX_SAMPLES. \n",
+        "- Internalformat is a depth- or stencil-renderable format and samples is greater than the value of GL_MAX_DEPTH_TEXTURE_SAMPLES. \n- Internalformat is a color-renderable format and samples is greater than the value of GL_MAX_COLOR_TEXTURE_SAMPLES. \n- Internalformat is a signed or unsigned integer format and samples is greater than the value of GL_MAX_INTEGER_SAMPLES. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexImage3D",
+      "void glTexImage3D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- Target is not GL_TEXTURE_3D or GL_PROXY_TEXTURE_3D. \n- Format is not an accepted format constant. Format constants other than GL_STENCIL_INDEX and GL_DEPTH_COMPONENT are accepted. \n- Type is not a type constant. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 \342\201\241 max , where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- InternalFormat is not one of the accepted resolution and format symbolic constants. \n- Width, height, or depth is less than 0 or greater than GL_MAX_TEXTURE_SIZE. \n- Border is not 0. \n",
+        "- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- Format or internalFormat is GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT24, or GL_DEPTH_COMPONENT32. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexImage3DMultisample",
+      "void glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);",
+      {
+        "",
+        "- Either width or height negative or is greater than GL_MAX_TEXTURE_SIZE. \n- Depth is negative or is greater than GL_MAX_ARRAY_TEXTURE_LAYERS. \n- Samples is greater than GL_MAX_SAMPLES. \n",
+        "- Internalformat is a depth- or stencil-renderable format and samples is greater than the value of GL_MAX_DEPTH_TEXTURE_SAMPLES. \n- Internalformat is a color-renderable format and samples is greater than the value of GL_MAX_COLOR_TEXTURE_SAMPLES. \n- Internalformat is a signed or unsigned integer format and samples is greater than the value of GL_MAX_INTEGER_SAMPLES. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameterIiv",
+      "void glTexParameterIiv(GLenum target, GLenum pname, const GLint * params);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameterIuiv",
+      "void glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameterf",
+      "void glTexParameterf(GLenum target, GLenum pname, GLfloat param);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameterfv",
+      "void glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameteri",
+      "void glTexParameteri(GLenum target, GLenum pname, GLint param);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexParameteriv",
+      "void glTexParameteriv(GLenum target, GLenum pname, const GLint * params);",
+      {
+        "- Target or pname is not one of the accepted defined values. \n- Params should have a defined constant value (based on the value of pname) and does not. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexStorage1D",
+      "void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width);",
+      {
+        "- Internalformat is not a valid sized internal format. \n- Target is not GL_TEXTURE_1D or GL_TEXTURE_2D. \n",
+        "- Width or levels are less than 1. \n",
+        "- Levels is greater than log 2 width + 1 . \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexStorage2D",
+      "void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);",
+      {
+        "- Internalformat is not a valid sized internal format. \n- Target is not one of the accepted target enumerants. \n",
+        "- Width or levels are less than 1. \n",
+        "- Target is GL_TEXTURE_1D_ARRAY or GL_PROXY_TEXTURE_1D_ARRAY and levels is greater than log 2 width + 1 . \n- Target is not GL_TEXTURE_1D_ARRAY or GL_PROXY_TEXTURE_1D_ARRAY and levels is greater than log 2 max width , height + 1 . \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexStorage2DMultisample",
+      "void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);",
+      {
+        "- Internalformat is not a valid color-renderable, depth-renderable or stencil-renderable format. \n- Target is not one of the accepted target enumerants. \n",
+        "- Width or height are less than 1 or greater than the value of GL_MAX_TEXTURE_SIZE. \n- Samples is greater than the value of GL_MAX_SAMPLES. \n",
+        "- The value of GL_TEXTURE_IMMUTABLE_FORMAT for the texture bound to target is not GL_FALSE. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexStorage3D",
+      "void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);",
+      {
+        "- Internalformat is not a valid sized internal format. \n- Target is not one of the accepted target enumerants. \n",
+        "- Width or levels are less than 1. \n",
+        "- Target is GL_TEXTURE_3D or GL_PROXY_TEXTURE_3D and levels is greater than log 2 max width , height , depth + 1 . \n- Target is GL_TEXTURE_2D_ARRAY, GL_PROXY_TEXTURE_2D_ARRAY, GL_TEXURE_CUBE_ARRAY, or GL_PROXY_TEXTURE_CUBE_MAP_ARRAY and levels is greater than log 2 max width , height + 1 . \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexStorage3DMultisample",
+      "void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);",
+      {
+        "- Internalformat is not a valid color-renderable, depth-renderable or stencil-renderable format. \n- Target is not one of the accepted target enumerants. \n",
+        "- Width or height are less than 1 or greater than the value of GL_MAX_TEXTURE_SIZE. \n- Depth is less than 1 or greater than the value of GL_MAX_ARRAY_TEXTURE_LAYERS. \n- Samples is greater than the value of GL_MAX_SAMPLES. \n",
+        "- The value of GL_TEXTURE_IMMUTABLE_FORMAT for the texture bound to target is not GL_FALSE. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexSubImage1D",
+      "void glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- Target is not one of the allowable values. \n- Format is not an accepted format constant. \n- Type is not a type constant. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 max, where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Xoffset < - b , or if xoffset + width > w - b , where w is the GL_TEXTURE_WIDTH, and b is the width of the GL_TEXTURE_BORDER of the texture image being modified. Note that w includes twice the border width. \n- Width is less than 0. \n",
+        "- The texture array has not been defined by a previous glTexImage1D operation. \n- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- Format is GL_STENCIL_INDEX and the base internal format is not GL_STENCIL_INDEX. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexSubImage2D",
+      "void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- Target is not GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP_POSITIVE_X, GL_TEXTURE_CUBE_MAP_NEGATIVE_X, GL_TEXTURE_CUBE_MAP_POSITIVE_Y, GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, GL_TEXTURE_CUBE_MAP_POSITIVE_Z, GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, or GL_TEXTURE_1D_ARRAY. \n- Format is not an accepted format constant. \n- Type is not a type constant. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 max, where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Xoffset < - b , xoffset + width > w - b , yoffset < - b , or yoffset + height > h - b , where w is the GL_TEXTURE_WIDTH, h is the GL_TEXTURE_HEIGHT, and b is the border width of the texture image being modified. Note that w and h include twice the border width. \n- Width or height is less than 0. \n",
+        "- The texture array has not been defined by a previous glTexImage2D operation. \n- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- Format is GL_STENCIL_INDEX and the base internal format is not GL_STENCIL_INDEX. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTexSubImage3D",
+      "void glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * data);",
+      {
+        "- /target is not GL_TEXTURE_3D or GL_TEXTURE_2D_ARRAY. \n- Format is not an accepted format constant. \n- Type is not a type constant. \n",
+        "- Level is less than 0. \n- Level is greater than log 2 max, where max is the returned value of GL_MAX_TEXTURE_SIZE. \n- Xoffset < - b , xoffset + width > w - b , yoffset < - b , or yoffset + height > h - b , or zoffset < - b , or zoffset + depth > d - b , where w is the GL_TEXTURE_WIDTH, h is the GL_TEXTURE_HEIGHT, d is the GL_TEXTURE_DEPTH and b is the border width of the texture image being modified. Note that w, h, and d include twice the border width. \n- Width, height, or depth is less than 0. \n",
+        "- The texture array has not been defined by a previous glTexImage3D or glTexStorage3D operation. \n- Type is one of GL_UNSIGNED_BYTE_3_3_2, GL_UNSIGNED_BYTE_2_3_3_REV, GL_UNSIGNED_SHORT_5_6_5, or GL_UNSIGNED_SHORT_5_6_5_REV and format is not GL_RGB. \n- Type is one of GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_SHORT_4_4_4_4_REV, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_SHORT_1_5_5_5_REV, GL_UNSIGNED_INT_8_8_8_8, GL_UNSIGNED_INT_8_8_8_8_REV, GL_UNSIGNED_INT_10_10_10_2, or GL_UNSIGNED_INT_2_10_10_10_REV and format is neither GL_RGBA nor GL_BGRA. \n- Format is GL_STENCIL_INDEX and the base internal format is not GL_STENCIL_INDEX. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the buffer object's data store is currently mapped. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and the data would be unpacked from the buffer object such that the memory reads required would exceed the data store size. \n- A non-zero buffer object name is bound to the GL_PIXEL_UNPACK_BUFFER target and data is not evenly divisible into the number of bytes needed to store in memory a datum indicated by type. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTextureView",
+      "void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers);",
+      {
+        "",
+        "- Minlayer or minlevel are larger than the greatest layer or level of origtexture. \n- _INVALID_VALUE is generaged if target is GL_TEXTURE_CUBE_MAP and numlayers is not 6, or if target is GL_TEXTURE_CUBE_MAP_ARRAY and numlayers is not an integer multiple of 6. \n- Target is GL_TEXTURE_1D, GL_TEXTURE_2D, GL_TEXTURE_3D, GL_TEXTURE_RECTANGLE, or GL_TEXTURE_2D_MULTISAMPLE and numlayers does not equal 1. \n- Texture zero or is not the name of a texture previously returned from a successful call to glGenTextures. \n",
+        "- Target is not compatible with the target of origtexture. \n- The dimensions of origtexture are greater than the maximum supported dimensions for target. \n- Internalformat is not compatible with the internal format of origtexture. \n- Texture has already been bound or otherwise given a target. \n- The value of GL_TEXTURE_IMMUTABLE_FORMAT for origtexture is not GL_TRUE. \n- Origtexture is not the name of an existing texture object. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glTransformFeedbackVaryings",
+      "void glTransformFeedbackVaryings(GLuintprogram, GLsizeicount, const char **varyings, GLenumbufferMode);",
+      {
+        "",
+        "- Program is not the name of a program object. \n- BufferMode is GL_SEPARATE_ATTRIBS and count is greater than the implementation-dependent limit GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1f",
+      "void glUniform1f(GLint location, GLfloat v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1fv",
+      "void glUniform1fv(GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1i",
+      "void glUniform1i(GLint location, GLint v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1iv",
+      "void glUniform1iv(GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1ui",
+      "void glUniform1ui(GLint location, GLuint v0);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform1uiv",
+      "void glUniform1uiv(GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2f",
+      "void glUniform2f(GLint location, GLfloat v0, GLfloat v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2fv",
+      "void glUniform2fv(GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2i",
+      "void glUniform2i(GLint location, GLint v0, GLint v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2iv",
+      "void glUniform2iv(GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2ui",
+      "void glUniform2ui(GLint location, GLuint v0, GLuint v1);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform2uiv",
+      "void glUniform2uiv(GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3f",
+      "void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3fv",
+      "void glUniform3fv(GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3i",
+      "void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3iv",
+      "void glUniform3iv(GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3ui",
+      "void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform3uiv",
+      "void glUniform3uiv(GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4f",
+      "void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4fv",
+      "void glUniform4fv(GLint location, GLsizei count, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4i",
+      "void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4iv",
+      "void glUniform4iv(GLint location, GLsizei count, const GLint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4ui",
+      "void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniform4uiv",
+      "void glUniform4uiv(GLint location, GLsizei count, const GLuint *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformBlockBinding",
+      "void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);",
+      {
+        "",
+        "- UniformBlockIndex is not an active uniform block index of program. \n- UniformBlockBinding is greater than or equal to the value of GL_MAX_UNIFORM_BUFFER_BINDINGS. \n- Program is not the name of a program object generated by the GL. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix2fv",
+      "void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix2x3fv",
+      "void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix2x4fv",
+      "void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix3fv",
+      "void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix3x2fv",
+      "void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix3x4fv",
+      "void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix4fv",
+      "void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix4x2fv",
+      "void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformMatrix4x3fv",
+      "void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);",
+      {
+        "",
+        "- Count is less than 0.\n",
+        "- There is no current program object.\n- The size of the uniform variable declared in the shader does not match the size indicated by the glUniform command.\n- One of the signed or unsigned integer variants of this function is used to load a uniform variable of type float, vec2, vec3, vec4, or an array of these, or if one of the floating-point variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the signed integer variants of this function is used to load a uniform variable of type unsigned int, uvec2, uvec3, uvec4, or an array of these.\n- One of the unsigned integer variants of this function is used to load a uniform variable of type int, ivec2, ivec3, ivec4, or an array of these.\n- Location is an invalid uniform location for the current program object and location is not equal to -1.\n- Count is greater than 1 and the indicated uniform variable is not an array variable.\n- A sampler is loaded using a command other than glUniform1i and glUniform1iv.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUniformSubroutinesuiv",
+      "void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices);",
+      {
+        "- Shadertype is not one of the accepted values. \n",
+        "- Count is not equal to the value of GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS for the shader stage shadertype of the current program. \n- Any value in indices is geater than or equal to the value of GL_ACTIVE_SUBROUTINES for the shader stage shadertype of the current program. \n",
+        "- No program object is current. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUnmapBuffer",
+      "GLboolean glUnmapBuffer(GLenum target);",
+      {
+        "- Target is not one of the accepted targets. \n- Access is not GL_READ_ONLY, GL_WRITE_ONLY, or GL_READ_WRITE. \n",
+        "",
+        "- The reserved buffer object name 0 is bound to target. \n- GlMapBuffer is executed for a buffer object whose data store is already mapped. \n- GlUnmapBuffer is executed for a buffer object whose data store is not currently mapped. \n",
+        "",
+        "",
+        "- _OUT_OF_MEMORY is generated when glMapBuffer is executed if the GL is unable to map the buffer object's data store. This may occur for a variety of system-specific reasons, such as the absence of sufficient remaining virtual memory. \n",
+        "",
+        "",
+      }
+    },
+    {
+      "glUseProgram",
+      "void glUseProgram(GLuint program);",
+      {
+        "",
+        "- Program is neither 0 nor a value generated by OpenGL.\n",
+        "- Program is not a program object.\n- Program could not be made part of current state.\n- Transform feedback mode is active.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glUseProgramStages",
+      "void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program);",
+      {
+        "",
+        "- Shaders contains set bits that are not recognized, and is not the reserved value GL_ALL_SHADER_BITS. \n",
+        "- Program refers to a program object that was not linked with its GL_PROGRAM_SEPARABLE status set. \n- Program refers to a program object that has not been successfully linked. \n- Pipeline is not a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glValidateProgram",
+      "void glValidateProgram(GLuint program);",
+      {
+        "",
+        "- Program is not a value generated by OpenGL.\n",
+        "- Program is not a program object.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glValidateProgramPipeline",
+      "void glValidateProgramPipeline(GLuint pipeline);",
+      {
+        "",
+        "",
+        "- Pipeline is not a name previously returned from a call to glGenProgramPipelines or if such a name has been deleted by a call to glDeleteProgramPipelines. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1d",
+      "void glVertexAttrib1d(GLuint index, GLdouble v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1dv",
+      "void glVertexAttrib1dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1f",
+      "void glVertexAttrib1f(GLuint index, GLfloat v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1fv",
+      "void glVertexAttrib1fv(GLuint index, const GLfloat *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1s",
+      "void glVertexAttrib1s(GLuint index, GLshort v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib1sv",
+      "void glVertexAttrib1sv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2d",
+      "void glVertexAttrib2d(GLuint index, GLdouble v0, GLdouble v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2dv",
+      "void glVertexAttrib2dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2f",
+      "void glVertexAttrib2f(GLuint index, GLfloat v0, GLfloat v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2fv",
+      "void glVertexAttrib2fv(GLuint index, const GLfloat *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2s",
+      "void glVertexAttrib2s(GLuint index, GLshort v0, GLshort v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib2sv",
+      "void glVertexAttrib2sv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3d",
+      "void glVertexAttrib3d(GLuint index, GLdouble v0, GLdouble v1, GLdouble v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3dv",
+      "void glVertexAttrib3dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3f",
+      "void glVertexAttrib3f(GLuint index, GLfloat v0, GLfloat v1, GLfloat v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3fv",
+      "void glVertexAttrib3fv(GLuint index, const GLfloat *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3s",
+      "void glVertexAttrib3s(GLuint index, GLshort v0, GLshort v1, GLshort v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib3sv",
+      "void glVertexAttrib3sv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nbv",
+      "void glVertexAttrib4Nbv(GLuint index, const GLbyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Niv",
+      "void glVertexAttrib4Niv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nsv",
+      "void glVertexAttrib4Nsv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nub",
+      "void glVertexAttrib4Nub(GLuint index, GLubyte v0, GLubyte v1, GLubyte v2, GLubyte v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nubv",
+      "void glVertexAttrib4Nubv(GLuint index, const GLubyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nuiv",
+      "void glVertexAttrib4Nuiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4Nusv",
+      "void glVertexAttrib4Nusv(GLuint index, const GLushort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4bv",
+      "void glVertexAttrib4bv(GLuint index, const GLbyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4d",
+      "void glVertexAttrib4d(GLuint index, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4dv",
+      "void glVertexAttrib4dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4f",
+      "void glVertexAttrib4f(GLuint index, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4fv",
+      "void glVertexAttrib4fv(GLuint index, const GLfloat *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4iv",
+      "void glVertexAttrib4iv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4s",
+      "void glVertexAttrib4s(GLuint index, GLshort v0, GLshort v1, GLshort v2, GLshort v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4sv",
+      "void glVertexAttrib4sv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4ubv",
+      "void glVertexAttrib4ubv(GLuint index, const GLubyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4uiv",
+      "void glVertexAttrib4uiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttrib4usv",
+      "void glVertexAttrib4usv(GLuint index, const GLushort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribBinding",
+      "void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex);",
+      {
+        "",
+        "- Attribindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if bindingindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIB_BINDINGS. \n",
+      }
+    },
+    {
+      "glVertexAttribDivisor",
+      "void glVertexAttribDivisor(GLuint index, GLuint divisor);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribFormat",
+      "void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);",
+      {
+        "- Type is not one of the accepted tokens. \n",
+        "- Size is not one of the accepted values. \n- Relativeoffset is greater than the value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if attribindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+      }
+    },
+    {
+      "glVertexAttribI1i",
+      "void glVertexAttribI1i(GLuint index, GLint v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI1iv",
+      "void glVertexAttribI1iv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI1ui",
+      "void glVertexAttribI1ui(GLuint index, GLuint v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI1uiv",
+      "void glVertexAttribI1uiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI2i",
+      "void glVertexAttribI2i(GLuint index, GLint v0, GLint v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI2iv",
+      "void glVertexAttribI2iv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI2ui",
+      "void glVertexAttribI2ui(GLuint index, GLuint v0, GLuint v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI2uiv",
+      "void glVertexAttribI2uiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI3i",
+      "void glVertexAttribI3i(GLuint index, GLint v0, GLint v1, GLint v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI3iv",
+      "void glVertexAttribI3iv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI3ui",
+      "void glVertexAttribI3ui(GLuint index, GLuint v0, GLuint v1, GLuint v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI3uiv",
+      "void glVertexAttribI3uiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4bv",
+      "void glVertexAttribI4bv(GLuint index, const GLbyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4i",
+      "void glVertexAttribI4i(GLuint index, GLint v0, GLint v1, GLint v2, GLint v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4iv",
+      "void glVertexAttribI4iv(GLuint index, const GLint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4sv",
+      "void glVertexAttribI4sv(GLuint index, const GLshort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4ubv",
+      "void glVertexAttribI4ubv(GLuint index, const GLubyte *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4ui",
+      "void glVertexAttribI4ui(GLuint index, GLuint v0, GLuint v1, GLuint v2, GLuint v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4uiv",
+      "void glVertexAttribI4uiv(GLuint index, const GLuint *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribI4usv",
+      "void glVertexAttribI4usv(GLuint index, const GLushort *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribIFormat",
+      "void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);",
+      {
+        "- Type is not one of the accepted tokens. \n",
+        "- Size is not one of the accepted values. \n- Relativeoffset is greater than the value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if attribindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+      }
+    },
+    {
+      "glVertexAttribIPointer",
+      "void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer);",
+      {
+        "- Type is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n- Size is not 1, 2, 3, 4 or (for glVertexAttribPointer), GL_BGRA.\n- Stride is negative.\n",
+        "- Size is GL_BGRA and type is not GL_UNSIGNED_BYTE, GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV.\n- Type is GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV and size is not 4 or GL_BGRA.\n- Type is GL_UNSIGNED_INT_10F_11F_11F_REV and size is not 3.\n- _INVALID_OPERATION is generated by glVertexAttribPointer if size is GL_BGRA and noramlized is GL_FALSE.\n- Zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL1d",
+      "void glVertexAttribL1d(GLuint index, GLdouble v0);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL1dv",
+      "void glVertexAttribL1dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL2d",
+      "void glVertexAttribL2d(GLuint index, GLdouble v0, GLdouble v1);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL2dv",
+      "void glVertexAttribL2dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL3d",
+      "void glVertexAttribL3d(GLuint index, GLdouble v0, GLdouble v1, GLdouble v2);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL3dv",
+      "void glVertexAttribL3dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL4d",
+      "void glVertexAttribL4d(GLuint index, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribL4dv",
+      "void glVertexAttribL4dv(GLuint index, const GLdouble *v);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribLFormat",
+      "void glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);",
+      {
+        "- Type is not one of the accepted tokens. \n",
+        "- Size is not one of the accepted values. \n- Relativeoffset is greater than the value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET. \n",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if attribindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIBS. \n",
+      }
+    },
+    {
+      "glVertexAttribLPointer",
+      "void glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer);",
+      {
+        "- Type is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n- Size is not 1, 2, 3, 4 or (for glVertexAttribPointer), GL_BGRA.\n- Stride is negative.\n",
+        "- Size is GL_BGRA and type is not GL_UNSIGNED_BYTE, GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV.\n- Type is GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV and size is not 4 or GL_BGRA.\n- Type is GL_UNSIGNED_INT_10F_11F_11F_REV and size is not 3.\n- _INVALID_OPERATION is generated by glVertexAttribPointer if size is GL_BGRA and noramlized is GL_FALSE.\n- Zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribP1ui",
+      "void glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribP2ui",
+      "void glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribP3ui",
+      "void glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribP4ui",
+      "void glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);",
+      {
+        "- GlVertexAttribP* is used with a type other than GL_INT_2_10_10_10_REV, GL_UNSIGNED_INT_2_10_10_10_REV, or GL_UNSIGNED_INT_10F_11F_11F_REV.\n- GlVertexAttribL is used with a type other than GL_DOUBLE.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexAttribPointer",
+      "void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer);",
+      {
+        "- Type is not an accepted value.\n",
+        "- Index is greater than or equal to GL_MAX_VERTEX_ATTRIBS.\n- Size is not 1, 2, 3, 4 or (for glVertexAttribPointer), GL_BGRA.\n- Stride is negative.\n",
+        "- Size is GL_BGRA and type is not GL_UNSIGNED_BYTE, GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV.\n- Type is GL_INT_2_10_10_10_REV or GL_UNSIGNED_INT_2_10_10_10_REV and size is not 4 or GL_BGRA.\n- Type is GL_UNSIGNED_INT_10F_11F_11F_REV and size is not 3.\n- _INVALID_OPERATION is generated by glVertexAttribPointer if size is GL_BGRA and noramlized is GL_FALSE.\n- Zero is bound to the GL_ARRAY_BUFFER buffer object binding point and the pointer argument is not NULL.\n",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glVertexBindingDivisor",
+      "void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor);",
+      {
+        "",
+        "",
+        "- No vertex array object is bound. \n",
+        "",
+        "",
+        "",
+        "",
+        "- GL_INVAILD_VALUE is generated if bindingindex is greater than or equal to the value of GL_MAX_VERTEX_ATTRIB_BINDINGS. \n",
+      }
+    },
+    {
+      "glViewport",
+      "void glViewport(GLint x, GLint y, GLsizei width, GLsizei height);",
+      {
+        "",
+        "- Either width or height is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glViewportArrayv",
+      "void glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v);",
+      {
+        "",
+        "- First is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- First + count is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Either width or height is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glViewportIndexedf",
+      "void glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Either width or height is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glViewportIndexedfv",
+      "void glViewportIndexedfv(GLuint index, const GLfloat *v);",
+      {
+        "",
+        "- Index is greater than or equal to the value of GL_MAX_VIEWPORTS. \n- Either width or height is negative. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+    {
+      "glWaitSync",
+      "void glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);",
+      {
+        "",
+        "- Sync is not the name of a sync object. \n- Flags is not zero. \n- Timeout is not GL_TIMEOUT_IGNORED. \n",
+        "",
+        "",
+        "",
+        "",
+        "",
+        "",
+      }
+    },
+  };
+  *size = sizeof(table) / sizeof(table[0]);
+  return table;
+}
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_DEBUG_GLERRORS_TABLE_H_
@@ -57,7 +57,8 @@ inline void OGLWRAP_print_another_object_is_bound_error(const char *file,
     ErrorMessage {
       "BIND CHECK FAILURE",
       "The function is called through an object that is different "
-      "than the one, currently bound to " + DebugOutput::LastUsedBindTarget() +
+      "than the one, currently bound to " +
+      std::string{DebugOutput::LastUsedBindTarget()} +
       ".\nDid you forget to call Bind() on the object? \n\n",
       file, func, line
     }
@@ -72,7 +73,7 @@ inline void OGLWRAP_print_default_object_is_bound_error(const char *file,
     ErrorMessage {
       "BIND CHECK FAILURE",
       "The function requires an object to be bound to " +
-      DebugOutput::LastUsedBindTarget() + " but only the default object '0' is "
+      std::string{DebugOutput::LastUsedBindTarget()} + " but only the default object '0' is "
       "bound to that target.\n\n",
       file, func, line
     }
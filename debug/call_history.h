@@ -0,0 +1,119 @@
+// Copyright (c) Tamas Csala
+
+/** @file call_history.h
+    @brief Implements a fixed size record of the last wrapped gl calls.
+*/
+
+#ifndef OGLWRAP_DEBUG_CALL_HISTORY_H_
+#define OGLWRAP_DEBUG_CALL_HISTORY_H_
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "../config.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEBUG
+
+/// Remembers the last OGLWRAP_CALL_HISTORY_SIZE gl calls made through oglwrap.
+/** Used by the deferred error checking, to tell which calls could have caused
+  * an error found by a later glGetError. Recording a call only stores four
+  * pointers to string literals in a ring, so it doesn't allocate, and it doesn't
+  * reach the driver either. */
+class CallHistory {
+ public:
+  /// A wrapped gl call.
+  struct Call {
+    const char *call;
+    const char *file;
+    const char *function;
+    int line;
+  };
+
+  /// Records a call. The strings must be string literals (or live forever).
+  /** @return true if OGLWRAP_ERROR_CHECK_INTERVAL calls were recorded since the
+    *         last Clear(), so it's time to check the errors. */
+  static bool Record(const char *call, const char *file,
+                     const char *function, int line) {
+    CallHistory& history = GetInstanceSingleton();
+    history.calls_[history.next_] = Call{call, file, function, line};
+    history.next_ = (history.next_ + 1) % OGLWRAP_CALL_HISTORY_SIZE;
+    if (history.size_ < OGLWRAP_CALL_HISTORY_SIZE) {
+      history.size_++;
+    }
+    history.calls_since_clear_++;
+  #if OGLWRAP_ERROR_CHECK_INTERVAL
+    return history.calls_since_clear_ >= OGLWRAP_ERROR_CHECK_INTERVAL;
+  #else
+    return false;
+  #endif
+  }
+
+  /// Returns the number of calls recorded since the last Clear().
+  static size_t CallsSinceClear() {
+    return GetInstanceSingleton().calls_since_clear_;
+  }
+
+  /// Returns the number of calls that are remembered (at most the ring size).
+  static size_t Size() {
+    return GetInstanceSingleton().size_;
+  }
+
+  /// Returns the i-th remembered call, 0 is the oldest one.
+  static const Call& Get(size_t i) {
+    const CallHistory& history = GetInstanceSingleton();
+    size_t oldest = (history.next_ + OGLWRAP_CALL_HISTORY_SIZE - history.size_)
+                    % OGLWRAP_CALL_HISTORY_SIZE;
+    return history.calls_[(oldest + i) % OGLWRAP_CALL_HISTORY_SIZE];
+  }
+
+  /// Returns the most recent call, or nullptr if there's none.
+  static const Call* Last() {
+    return Size() ? &Get(Size() - 1) : nullptr;
+  }
+
+  /// Forgets the remembered calls.
+  static void Clear() {
+    CallHistory& history = GetInstanceSingleton();
+    history.size_ = 0;
+    history.calls_since_clear_ = 0;
+  }
+
+  /// Lists the remembered calls, the oldest first.
+  static std::string Format() {
+    std::stringstream sstream;
+    size_t size = Size();
+    size_t calls = CallsSinceClear();
+    if (calls > size) {
+      sstream << "(" << calls - size << " earlier calls are not remembered)\n";
+    }
+    for (size_t i = 0; i < size; ++i) {
+      const Call& call = Get(i);
+      sstream << "  " << call.call << "\n"
+              << "      in '" << call.file << "' at line " << call.line
+              << "\n";
+    }
+    return sstream.str();
+  }
+
+ private:
+  Call calls_[OGLWRAP_CALL_HISTORY_SIZE];
+  size_t next_ = 0;
+  size_t size_ = 0;
+  size_t calls_since_clear_ = 0;
+
+  CallHistory() = default;
+
+  static CallHistory& GetInstanceSingleton() {
+    static CallHistory instance;
+    return instance;
+  }
+};
+
+#endif  // OGLWRAP_DEBUG
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_DEBUG_CALL_HISTORY_H_
@@ -0,0 +1,183 @@
+// Copyright (c) Tamas Csala
+
+/** @file debug_callback.h
+    @brief Implements error reporting through the KHR_debug message callback.
+*/
+
+#ifndef OGLWRAP_DEBUG_DEBUG_CALLBACK_H_
+#define OGLWRAP_DEBUG_DEBUG_CALLBACK_H_
+
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include "../config.h"
+#include "./debug_output.h"
+#include "./call_history.h"
+#include "../context/state_cache.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEBUG
+
+/// Reports the messages of the driver's debug output (KHR_debug).
+/** Instead of polling glGetError, the driver calls back when something goes
+  * wrong, so the wrapped calls don't have any per call query cost. Besides the
+  * errors, this reports the performance warnings (like buffer stalls and shader
+  * recompiles), and the other warnings the driver has, through the same
+  * DebugOutput::PrintError as the other oglwrap errors.
+  *
+  * Every wrapped call marks itself as the current call of its thread after it
+  * returned. With synchronous debug output, the messages are generated inside
+  * the gl call, so they are collected, and reported right after the call,
+  * together with the call's location. With asynchronous output, the messages
+  * are reported immediately, with the last call made on the thread that the
+  * driver calls back on (which is only a hint).
+  *
+  * The wrapped calls only use this backend if OGLWRAP_USE_DEBUG_CALLBACK is
+  * true, and it has to be enabled with Enable() after the context was made
+  * current. */
+class DebugCallback {
+ public:
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glDebugMessageCallback)
+  /// Registers the callback and enables the debug output.
+  /** @param synchronous            If true, the messages are generated in the
+    *                               call that caused them, so they can be
+    *                               attributed exactly, but the driver might be
+    *                               slower.
+    * @param report_notifications   If false, messages with notification
+    *                               severity aren't reported.
+    * @see glDebugMessageCallback, GL_DEBUG_OUTPUT_SYNCHRONOUS */
+  static void Enable(bool synchronous = true,
+                     bool report_notifications = false) {
+    Synchronous() = synchronous;
+    ReportNotifications() = report_notifications;
+    glDebugMessageCallback(Callback, nullptr);
+    glEnable(GL_DEBUG_OUTPUT);
+    if (synchronous) {
+      glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    } else {
+      glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+    StateCache::Forget(GL_DEBUG_OUTPUT);
+    StateCache::Forget(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  }
+
+  /// Unregisters the callback and disables the debug output.
+  static void Disable() {
+    glDisable(GL_DEBUG_OUTPUT);
+    glDebugMessageCallback(nullptr, nullptr);
+    StateCache::Forget(GL_DEBUG_OUTPUT);
+  }
+#endif
+
+  /// Marks a wrapped call as the current one of this thread, and reports the
+  /// messages that were generated since the previous call.
+  /** The strings must be string literals (or live forever). */
+  static void MarkCall(const char *call, const char *file,
+                       const char *function, int line) {
+    ThreadState& state = GetThreadState();
+    state.current_call = CallHistory::Call{call, file, function, line};
+    if (!state.pending.empty()) {
+      std::vector<ErrorMessage> pending;
+      pending.swap(state.pending);
+      for (ErrorMessage& message : pending) {
+        message.file = file;
+        message.function = function;
+        message.line = line;
+        message.call_string = call;
+        DebugOutput::PrintError(message);
+      }
+    }
+  }
+
+ private:
+  struct ThreadState {
+    CallHistory::Call current_call = CallHistory::Call{"", "", "", -1};
+    std::vector<ErrorMessage> pending;
+  };
+
+  static ThreadState& GetThreadState() {
+    static thread_local ThreadState state;
+    return state;
+  }
+
+  static bool& Synchronous() {
+    static bool synchronous = true;
+    return synchronous;
+  }
+
+  static bool& ReportNotifications() {
+    static bool report_notifications = false;
+    return report_notifications;
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glDebugMessageCallback)
+  static const char* TypeTitle(GLenum type) {
+    switch (type) {
+      case GL_DEBUG_TYPE_ERROR: return "OpenGL Error";
+      case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "Deprecated Behavior";
+      case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "Undefined Behavior";
+      case GL_DEBUG_TYPE_PORTABILITY: return "Portability Warning";
+      case GL_DEBUG_TYPE_PERFORMANCE: return "Performance Warning";
+      default: return "Debug Message";
+    }
+  }
+
+  static const char* SourceName(GLenum source) {
+    switch (source) {
+      case GL_DEBUG_SOURCE_API: return "API";
+      case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "Window System";
+      case GL_DEBUG_SOURCE_SHADER_COMPILER: return "Shader Compiler";
+      case GL_DEBUG_SOURCE_THIRD_PARTY: return "Third Party";
+      case GL_DEBUG_SOURCE_APPLICATION: return "Application";
+      default: return "Other";
+    }
+  }
+
+  static const char* SeverityName(GLenum severity) {
+    switch (severity) {
+      case GL_DEBUG_SEVERITY_HIGH: return "high";
+      case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+      case GL_DEBUG_SEVERITY_LOW: return "low";
+      default: return "notification";
+    }
+  }
+
+  static void GLAPIENTRY Callback(GLenum source, GLenum type, GLuint id,
+                                  GLenum severity, GLsizei length,
+                                  const GLchar *text, const void *) {
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION && !ReportNotifications()) {
+      return;
+    }
+
+    std::stringstream sstream;
+    sstream << "Source: " << SourceName(source)
+            << ", severity: " << SeverityName(severity)
+            << ", id: " << id << "\n\n";
+    if (length < 0) {
+      sstream << text;
+    } else {
+      sstream.write(text, length);
+    }
+    sstream << '\n';
+
+    ThreadState& state = GetThreadState();
+    if (Synchronous()) {
+      state.pending.push_back(ErrorMessage{TypeTitle(type), sstream.str()});
+    } else {
+      const CallHistory::Call& call = state.current_call;
+      DebugOutput::PrintError(
+        ErrorMessage{TypeTitle(type), sstream.str(), call.file, call.function,
+                     call.line, call.call}
+      );
+    }
+  }
+#endif
+};
+
+#endif  // OGLWRAP_DEBUG
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_DEBUG_DEBUG_CALLBACK_H_
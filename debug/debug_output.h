@@ -7,14 +7,10 @@
 #ifndef OGLWRAP_DEBUG_DEBUG_OUTPUT_H_
 #define OGLWRAP_DEBUG_DEBUG_OUTPUT_H_
 
-#include <map>
-#include <vector>
 #include <string>
-#include <utility>
-#include <cassert>
 #include <cstring>
-#include <fstream>
 #include <sstream>
+#include <algorithm>
 #include <iostream>
 #include <functional>
 
@@ -22,12 +18,14 @@
 #include "../enums/error_type.h"
 #include "./error_formatting.h"
 
+#if OGLWRAP_DEBUG
+  #include "./GLerrors_table.h"
+#endif
+
 namespace OGLWRAP_NAMESPACE_NAME {
 
 #if OGLWRAP_DEBUG
 
-#define OGLWRAP_GET_FILENAME() __FILE__
-
 /**
  * @brief A configurable debug output that warns you if an
  *        OpenGL or a binding error happens.
@@ -51,23 +49,6 @@ class DebugOutput {
     ADDITIONAL_NOTES = NUM_ERRORS
   };
 
-  const char* glErrorNames[NUM_ERRORS];
-
-  struct ErrorInfo {
-    std::string func_signature;
-    std::vector<std::string> errors[NUM_ERRORS + 1];
-
-    ErrorInfo() {}
-    ErrorInfo(const std::string& funcS, const std::vector<std::string> errs[])
-        : func_signature(funcS) {
-      for (int i = 0; i < NUM_ERRORS + 1; i++) {
-        errors[i] = errs[i];
-      }
-    }
-  };
-
-  std::map<std::string, ErrorInfo> error_map;
-
   glError_t getErrorIndex() const {
     switch (GLenum(LastError())) {
       case GL_INVALID_ENUM:
@@ -91,106 +72,22 @@ class DebugOutput {
 
   std::function<void(ErrorMessage error)> error_printer{ OGLWRAP_PrintError };
 
-  /// Loads in the list of OpenGL errors.
-  DebugOutput() {
-    glErrorNames[0] = "GL_INVALID_ENUM";
-    glErrorNames[1] = "GL_INVALID_VALUE";
-    glErrorNames[2] = "GL_INVALID_OPERATION";
-    glErrorNames[3] = "GL_STACK_OVERFLOW";
-    glErrorNames[4] = "GL_STACK_UNDERFLOW";
-    glErrorNames[5] = "GL_OUT_OF_MEMORY";
-    glErrorNames[6] = "GL_INVALID_FRAMEBUFFER_OPERATION";
-
-    // The GLerrors.txt should be in the same folder as this file.
-    // So we can use the __FILE__ macro to get the path (dir) of this file
-    std::string filename(OGLWRAP_GET_FILENAME());
-    auto dir = filename.find_last_of("/\\");
-    if (dir == std::string::npos) {
-      // If the path to this file has no directory in it, then
-      // we should search for just "GLerrors.txt"
-      filename.erase();
-    } else {
-      filename.erase(dir+1, std::string::npos);
-    }
-    filename.append("GLerrors.txt");
-
-    std::ifstream is(filename);
-    if (!is.good()) {
-      std::cerr << "Couldn't initialize DebugOutput because "
-                   "GLerrors.txt is missing or corrupted." << std::endl;
-      return;
-    }
-
-    // Read until EOF, or until an error occurs.
-    while (is.good()) {
-      std::string func, func_signature;
-      std::vector<std::string> errors[NUM_ERRORS + 1];
-      std::string buffer, buffer2;
-
-      // Get lines until the first one that's not empty.
-      while (getline(is, func_signature) && func_signature.empty());
-
-      size_t end_pos = func_signature.find('(');
-      size_t start_pos = func_signature.rfind(' ', end_pos) + 1;
-      func = func_signature.substr(start_pos, end_pos - start_pos);
-
-
-      // Get the error messages
-      while (getline(is, buffer) && !buffer.empty()) {
-        std::stringstream strstream(buffer);
-        strstream >> buffer2;
-        bool found_error = false;
-        bool in_a_list = false;
-        int last_err_type = NUM_ERRORS;
-
-        for (int i = 0; i < NUM_ERRORS; i++) {
-          if (buffer2 == glErrorNames[i]) {
-            // Make the error string a bit nicer
-            const char * possible_starts[3] = {
-              " is generated if ",
-              " error is generated if ",
-              " may be generated if ",
-            };
-            for (int j = 0; j < 3; j++) {
-              std::string errIsGendIf(buffer2 + possible_starts[j]);
-              if (buffer.find(errIsGendIf) == 0) {
-                buffer.erase(0, errIsGendIf.size() - 2);
-                break;
-              }
-            }
-            buffer[0] = '-';
-            buffer[1] = ' ';
-            buffer[2] = toupper(buffer[2]);
-            if (buffer[buffer.find_last_not_of(' ')] == ':') {
-              in_a_list = true;
-              last_err_type = i;
-            } else {
-              in_a_list = false;
-            }
-
-            errors[i].push_back(buffer);
-            found_error = true;
-            break;
-          }
-        }
-
-        // If it wasn't an error, than it was a
-        // - either a general note.
-        // - or an element inside a list.
-        if (!found_error) {
-          if (in_a_list) {
-            errors[last_err_type].back() += std::string("\n") + buffer;
-          } else {
-            errors[ADDITIONAL_NOTES].push_back(buffer);
-          }
-        }
-      }
+  DebugOutput() = default;
 
-      if (error_map.find(func) == error_map.end()) {
-        error_map.insert(std::pair<std::string, ErrorInfo>(
-            func, ErrorInfo(func_signature, errors)));
-      }
+  /// Finds the possible errors of an OpenGL function, returns nullptr if the
+  /// function isn't in the table.
+  static const OGLWRAP_GLErrorInfo* FindErrorInfo(const std::string& func) {
+    size_t size;
+    const OGLWRAP_GLErrorInfo* table = OGLWRAP_GLErrorTable(&size);
+    const OGLWRAP_GLErrorInfo* iter = std::lower_bound(
+        table, table + size, func.c_str(),
+        [](const OGLWRAP_GLErrorInfo& info, const char* name) {
+          return std::strcmp(info.name, name) < 0;
+        });
+    if (iter != table + size && func == iter->name) {
+      return iter;
     }
+    return nullptr;
   }
 
   static std::string FormatedFuncSignature(std::string func_signature) {
@@ -241,29 +138,26 @@ class DebugOutput {
     std::string funcName =
       std::string(function_call.begin(), function_call.begin() + func_name_len);
 
-    if (GetInstanceSingleton().error_map.find(funcName) != GetInstanceSingleton().error_map.end() &&
-       !GetInstanceSingleton().error_map[funcName].errors[err_idx].empty()) {
-      ErrorInfo errinfo = GetInstanceSingleton().error_map[funcName];
+    const OGLWRAP_GLErrorInfo* errinfo = FindErrorInfo(funcName);
+    if (errinfo && errinfo->errors[err_idx][0] != '\0') {
       sstream << "The following OpenGL function: \n\n";
-      sstream << FormatedFuncSignature(errinfo.func_signature) << "\n\n";
+      sstream << FormatedFuncSignature(errinfo->signature) << "\n\n";
       sstream << "Has generated the error because one of the "
                  "following(s) were true:\n";
-      for (size_t i = 0; i != errinfo.errors[err_idx].size(); ++i) {
-        sstream << errinfo.errors[err_idx][i] << std::endl;
-      }
-      if (errinfo.errors[ADDITIONAL_NOTES].size() != 0) {
+      sstream << errinfo->errors[err_idx];
+      if (errinfo->errors[ADDITIONAL_NOTES][0] != '\0') {
         sstream << std::endl << "Note that: " << std::endl;
-        for (size_t i = 0; i != errinfo.errors[ADDITIONAL_NOTES].size(); ++i) {
-          sstream << "- " << errinfo.errors[ADDITIONAL_NOTES][i] << std::endl;
-        }
+        sstream << errinfo->errors[ADDITIONAL_NOTES];
       }
     }
 
     return sstream.str();
   }
 
-  static std::string& LastUsedBindTarget() {
-    static std::string last_used_bind_target;
+  /// The name of the binding target that was checked last.
+  /** Always a string literal, so setting it doesn't allocate. */
+  static const char*& LastUsedBindTarget() {
+    static const char* last_used_bind_target = "";
     return last_used_bind_target;
   }
 
@@ -292,8 +186,10 @@ class DebugOutput {
    */
   static void GetDetailedErrorInfo(const std::string&, std::stringstream&) {}
 
-  static std::string& LastUsedBindTarget() {
-    static std::string last_used_bind_target;
+  /// The name of the binding target that was checked last.
+  /** Always a string literal, so setting it doesn't allocate. */
+  static const char*& LastUsedBindTarget() {
+    static const char* last_used_bind_target = "";
     return last_used_bind_target;
   }
 
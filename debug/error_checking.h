@@ -8,6 +8,8 @@
 #define OGLWRAP_DEBUG_ERROR_CHECKING_H_
 
 #include "./debug_output.h"
+#include "./call_history.h"
+#include "./debug_callback.h"
 #include "../context/errors.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
@@ -24,6 +26,15 @@ namespace OGLWRAP_NAMESPACE_NAME {
 
 #if OGLWRAP_DISABLE_DEBUG_OUTPUT
   #define OGLWRAP_CHECKED_GLFUNCTION(func) func;
+#elif OGLWRAP_USE_DEBUG_CALLBACK
+  #define OGLWRAP_CHECKED_GLFUNCTION(func) \
+    func;\
+    OGLWRAP_NAMESPACE_NAME::DebugCallback::MarkCall( \
+      #func, __FILE__, OGLWRAP_FUNCTION_MACRO, __LINE__);
+#elif OGLWRAP_DEFERRED_ERROR_CHECKING
+  #define OGLWRAP_CHECKED_GLFUNCTION(func) \
+    func;\
+    OGLWRAP_RECORD_CALL(#func);
 #else
   #define OGLWRAP_CHECKED_GLFUNCTION(func) \
     func;\
@@ -36,12 +47,17 @@ namespace OGLWRAP_NAMESPACE_NAME {
  * Conditionally prints more information about an error if the
  * condition equals with the last error catched by OGLWRAP_CHECK_ERROR()
  */
-#define OGLWRAP_PRINT_IF_ERROR(cond, title, message) \
-  if (DebugOutput::LastError() == cond) { \
-    DebugOutput::PrintError( \
-      ErrorMessage{title, message, __FILE__, OGLWRAP_FUNCTION_MACRO, __LINE__}  \
-    ); \
-  }
+#if OGLWRAP_DEFERRED_ERROR_CHECKING || OGLWRAP_USE_DEBUG_CALLBACK
+  // The error of a specific call isn't known without glGetError after it.
+  #define OGLWRAP_PRINT_IF_ERROR(cond, title, message)
+#else
+  #define OGLWRAP_PRINT_IF_ERROR(cond, title, message) \
+    if (DebugOutput::LastError() == cond) { \
+      DebugOutput::PrintError( \
+        ErrorMessage{title, message, __FILE__, OGLWRAP_FUNCTION_MACRO, __LINE__}  \
+      ); \
+    }
+#endif
 
 #define OGLWRAP_PRINT_ERROR(title, message) \
   DebugOutput::PrintError( \
@@ -70,26 +86,39 @@ namespace OGLWRAP_NAMESPACE_NAME {
   OGLWRAP_NAMESPACE_NAME::OGLWRAP_CheckError(__FILE__, OGLWRAP_FUNCTION_MACRO, __LINE__, glfunc)
 
 
+/**
+ * @brief Records a wrapped gl call for the deferred error checking, and checks
+ *        the errors if OGLWRAP_ERROR_CHECK_INTERVAL calls were made since the
+ *        last check.
+ */
+#define OGLWRAP_RECORD_CALL(glfunc) \
+  if (OGLWRAP_NAMESPACE_NAME::CallHistory::Record( \
+      glfunc, __FILE__, OGLWRAP_FUNCTION_MACRO, __LINE__)) { \
+    OGLWRAP_NAMESPACE_NAME::CheckErrors(); \
+  }
+
+inline std::string OGLWRAP_ErrorTitle(ErrorType error) {
+  switch (error) {
+    case ErrorType::kInvalidEnum: return "Invalid Enum";
+    case ErrorType::kInvalidValue: return "Invalid Value";
+    case ErrorType::kInvalidOperation: return "Invalid Operation";
+    case ErrorType::kStackOverflow: return "Stack Overflow";
+    case ErrorType::kStackUnderflow: return "Stack Underflow";
+    case ErrorType::kOutOfMemory: return "Out of Memory";
+    case ErrorType::kInvalidFramebufferOperation:
+      return "Invalid Framebuffer Operation";
+    default:
+      return std::string{};
+  }
+}
+
 inline void OGLWRAP_CheckError(const char *file,
                                const char *func,
                                int line,
                                const char* glfunc = "") {
   DebugOutput::LastError() = GetError();
   if (DebugOutput::LastError() != ErrorType::kNoError) {
-    std::string title;
-
-    switch (DebugOutput::LastError()) {
-      case ErrorType::kInvalidEnum: title = "Invalid Enum"; break;
-      case ErrorType::kInvalidValue: title = "Invalid Value"; break;
-      case ErrorType::kInvalidOperation: title = "Invalid Operation"; break;
-      case ErrorType::kStackOverflow: title = "Stack Overflow"; break;
-      case ErrorType::kStackUnderflow: title = "Stack Underflow"; break;
-      case ErrorType::kOutOfMemory: title = "Out of Memory"; break;
-      case ErrorType::kInvalidFramebufferOperation: title = "Invalid Framebuffer Operation"; break;
-      default:
-        break;
-    };
-
+    std::string title = OGLWRAP_ErrorTitle(DebugOutput::LastError());
     std::string message = DebugOutput::GetDetailedErrorInfo(glfunc);
 
     DebugOutput::PrintError(
@@ -97,6 +126,59 @@ inline void OGLWRAP_CheckError(const char *file,
     );
   }
 }
+
+/// Checks the errors of the calls that were recorded since the last check.
+/** Only does something if OGLWRAP_DEFERRED_ERROR_CHECKING is true. Every
+  * error flag that is set is reported, together with the remembered calls
+  * (one of which caused the error), at the location of the latest call.
+  * It should be called at least at the end of every frame.
+  * @see glGetError */
+inline void CheckErrors() {
+#if OGLWRAP_DEFERRED_ERROR_CHECKING && !OGLWRAP_USE_DEBUG_CALLBACK && \
+    !OGLWRAP_DISABLE_DEBUG_OUTPUT
+  if (CallHistory::CallsSinceClear() == 0) {
+    return;
+  }
+
+  // There can be more than one error flag set, but no more than the number
+  // of the error types.
+  for (int i = 0; i < 8; ++i) {
+    DebugOutput::LastError() = GetError();
+    if (DebugOutput::LastError() == ErrorType::kNoError) {
+      break;
+    }
+
+    const CallHistory::Call& last = *CallHistory::Last();
+    std::string message =
+      "The error was generated by one of the following calls "
+      "(the most recent is the last one):\n\n" + CallHistory::Format();
+    std::string details = DebugOutput::GetDetailedErrorInfo(last.call);
+    if (!details.empty()) {
+      message += "\nIf it was the last call, then:\n" + details;
+    }
+
+    DebugOutput::PrintError(
+      ErrorMessage{OGLWRAP_ErrorTitle(DebugOutput::LastError()), message,
+                   last.file, last.function, last.line}
+    );
+  }
+
+  CallHistory::Clear();
+#endif
+}
+
+/// Checks the deferred errors when the scope ends.
+/** Useful for narrowing down the call window of an error to a function, a
+  * render pass, or a frame. */
+class ErrorCheckScope {
+ public:
+  /// Checks the errors made before the scope, so they won't be reported here.
+  ErrorCheckScope() { CheckErrors(); }
+  ~ErrorCheckScope() { CheckErrors(); }
+
+  ErrorCheckScope(const ErrorCheckScope&) = delete;
+  ErrorCheckScope& operator=(const ErrorCheckScope&) = delete;
+};
 #else
   #define OGLWRAP_CHECKED_GLFUNCTION(func) func;
   #define OGLWRAP_PRINT_IF_ERROR(cond, title, message)
@@ -104,6 +186,15 @@ inline void OGLWRAP_CheckError(const char *file,
   #define OGLWRAP_PRINT_FATAL_ERROR(title, message)
   #define OGLWRAP_CHECK_ERROR()
   #define OGLWRAP_CHECK_ERROR_NAMED(glfunc)
+
+inline void CheckErrors() {}
+
+class ErrorCheckScope {
+ public:
+  ErrorCheckScope() {}
+  ErrorCheckScope(const ErrorCheckScope&) = delete;
+  ErrorCheckScope& operator=(const ErrorCheckScope&) = delete;
+};
 #endif
 
 #define OGLWRAP_CHECKED_FUNCTION(func) OGLWRAP_CHECKED_GLFUNCTION(gl##func)
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+# Copyright (c) Tamas Csala
+
+"""Generates GLerrors_table.h from GLerrors.txt.
+
+GLerrors.txt (made by generate_GLerrors.java) lists the signature and the
+possible errors of every OpenGL function. This script preprocesses it into a
+table that is sorted by the function names, so DebugOutput can binary search
+it, instead of reading and parsing the text file at runtime.
+
+Usage: python3 generate_GLerrors_table.py [GLerrors.txt] [GLerrors_table.h]
+"""
+
+import os
+import sys
+
+ERROR_NAMES = [
+    "GL_INVALID_ENUM",
+    "GL_INVALID_VALUE",
+    "GL_INVALID_OPERATION",
+    "GL_STACK_OVERFLOW",
+    "GL_STACK_UNDERFLOW",
+    "GL_OUT_OF_MEMORY",
+    "GL_INVALID_FRAMEBUFFER_OPERATION",
+]
+ADDITIONAL_NOTES = len(ERROR_NAMES)
+
+POSSIBLE_STARTS = [
+    " is generated if ",
+    " error is generated if ",
+    " may be generated if ",
+]
+
+
+def format_error(line, error_name):
+    """Makes an error line a bit nicer, like '- Target is not ...'"""
+    for start in POSSIBLE_STARTS:
+        prefix = error_name + start
+        if line.startswith(prefix):
+            line = line[len(prefix) - 2:]
+            break
+    first = line[2:3]
+    if 'a' <= first <= 'z':
+        first = first.upper()
+    return '- ' + first + line[3:]
+
+
+def parse(lines):
+    """Returns {function name: (signature, [error lines per error type])}"""
+    functions = {}
+    i = 0
+    while i < len(lines):
+        # Skip the empty lines before the signature.
+        while i < len(lines) and not lines[i]:
+            i += 1
+        if i == len(lines):
+            break
+        signature = lines[i]
+        i += 1
+
+        end_pos = signature.find('(')
+        start_pos = signature.rfind(' ', 0, end_pos) + 1
+        name = signature[start_pos:end_pos].lstrip('*')
+
+        errors = [[] for _ in range(ADDITIONAL_NOTES + 1)]
+        while i < len(lines) and lines[i]:
+            line = lines[i]
+            i += 1
+            words = line.split()
+            first_word = words[0] if words else ''
+            if first_word in ERROR_NAMES:
+                index = ERROR_NAMES.index(first_word)
+                errors[index].append(format_error(line, first_word))
+            else:
+                errors[ADDITIONAL_NOTES].append('- ' + line)
+
+        # The first description of a function wins.
+        if name and name not in functions:
+            functions[name] = (signature, errors)
+    return functions
+
+
+def c_string(text):
+    """Returns text as a C string literal (non-ascii bytes are escaped)."""
+    result = '"'
+    for byte in text.encode('utf-8'):
+        char = chr(byte)
+        if char == '"' or char == '\\':
+            result += '\\' + char
+        elif char == '\n':
+            result += '\\n'
+        elif 0x20 <= byte < 0x7F:
+            result += char
+        else:
+            result += '\\%03o' % byte
+    return result + '"'
+
+
+def generate(functions):
+    out = []
+    out.append('// Copyright (c) Tamas Csala')
+    out.append('// Generated by generate_GLerrors_table.py from GLerrors.txt, '
+               'don\'t edit it manually.')
+    out.append('')
+    out.append('/** @file GLerrors_table.h')
+    out.append('    @brief Contains the possible errors of the OpenGL functions,'
+               ' sorted by the')
+    out.append('           function names.')
+    out.append('*/')
+    out.append('')
+    out.append('#ifndef OGLWRAP_DEBUG_GLERRORS_TABLE_H_')
+    out.append('#define OGLWRAP_DEBUG_GLERRORS_TABLE_H_')
+    out.append('')
+    out.append('#include <cstddef>')
+    out.append('')
+    out.append('#include "../config.h"')
+    out.append('')
+    out.append('namespace OGLWRAP_NAMESPACE_NAME {')
+    out.append('')
+    out.append('/// The possible errors of an OpenGL function.')
+    out.append('struct OGLWRAP_GLErrorInfo {')
+    out.append('  /// The name of the function, like "glBindBuffer".')
+    out.append('  const char *name;')
+    out.append('  /// The signature of the function.')
+    out.append('  const char *signature;')
+    out.append('  /// The reasons of the errors (one line each), in the order of')
+    out.append('  /// GL_INVALID_ENUM, GL_INVALID_VALUE, GL_INVALID_OPERATION,')
+    out.append('  /// GL_STACK_OVERFLOW, GL_STACK_UNDERFLOW, GL_OUT_OF_MEMORY,')
+    out.append('  /// GL_INVALID_FRAMEBUFFER_OPERATION, and the additional notes.')
+    out.append('  const char *errors[%d];' % (ADDITIONAL_NOTES + 1))
+    out.append('};')
+    out.append('')
+    out.append('/// Returns the table of the OpenGL functions\' errors, sorted by '
+               'the names.')
+    out.append('/** The table is constant initialized, so it doesn\'t have any '
+               'startup cost. */')
+    out.append('inline const OGLWRAP_GLErrorInfo* '
+               'OGLWRAP_GLErrorTable(size_t *size) {')
+    out.append('  static const OGLWRAP_GLErrorInfo table[] = {')
+    # Sort by the bytes, to match strcmp.
+    for name in sorted(functions, key=lambda name: name.encode('utf-8')):
+        signature, errors = functions[name]
+        out.append('    {')
+        out.append('      %s,' % c_string(name))
+        out.append('      %s,' % c_string(signature))
+        out.append('      {')
+        for error_lines in errors:
+            text = ''.join(line + '\n' for line in error_lines)
+            out.append('        %s,' % c_string(text))
+        out.append('      }')
+        out.append('    },')
+    out.append('  };')
+    out.append('  *size = sizeof(table) / sizeof(table[0]);')
+    out.append('  return table;')
+    out.append('}')
+    out.append('')
+    out.append('}  // namespace oglwrap')
+    out.append('')
+    out.append('#endif  // OGLWRAP_DEBUG_GLERRORS_TABLE_H_')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    directory = os.path.dirname(os.path.abspath(__file__))
+    input_path = os.path.join(directory, 'GLerrors.txt')
+    output_path = os.path.join(directory, 'GLerrors_table.h')
+    if len(sys.argv) > 1:
+        input_path = sys.argv[1]
+    if len(sys.argv) > 2:
+        output_path = sys.argv[2]
+
+    with open(input_path, encoding='utf-8') as input_file:
+        lines = input_file.read().split('\n')
+    functions = parse(lines)
+
+    with open(output_path, 'w', encoding='utf-8') as output_file:
+        output_file.write(generate(functions))
+    print('Generated %s with %d functions.' % (output_path, len(functions)))
+
+
+if __name__ == '__main__':
+    main()
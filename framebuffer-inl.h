@@ -16,8 +16,12 @@ namespace OGLWRAP_NAMESPACE_NAME {
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glCheckFramebufferStatus)
 template<FramebufferType FBO_TYPE>
 FramebufferStatus FramebufferObject<FBO_TYPE>::status() const {
+#if OGLWRAP_USE_DSA
+  GLenum status = gl(CheckNamedFramebufferStatus(expose(), GLenum(FBO_TYPE)));
+#else
   OGLWRAP_CHECK_BINDING();
   GLenum status = gl(CheckFramebufferStatus(GLenum(FBO_TYPE)));
+#endif
   return FramebufferStatus(status);
 }
 #endif  // glCheckFramebufferStatus
@@ -25,9 +29,13 @@ FramebufferStatus FramebufferObject<FBO_TYPE>::status() const {
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glCheckFramebufferStatus)
 template<FramebufferType FBO_TYPE>
 void FramebufferObject<FBO_TYPE>::validate() const {
-  OGLWRAP_CHECK_BINDING();
   std::string error;
+#if OGLWRAP_USE_DSA
+  GLenum status = gl(CheckNamedFramebufferStatus(expose(), GLenum(FBO_TYPE)));
+#else
+  OGLWRAP_CHECK_BINDING();
   GLenum status = gl(CheckFramebufferStatus(GLenum(FBO_TYPE)));
+#endif
   switch (FramebufferStatus(status)) {
     case FramebufferStatus::kFramebufferComplete:
       return;
@@ -84,9 +92,14 @@ void FramebufferObject<FBO_TYPE>::validate() const {
 template<FramebufferType FBO_TYPE>
 void FramebufferObject<FBO_TYPE>::attachBuffer(
     FramebufferAttachment attachment, const Renderbuffer& render_buffer) {
+#if OGLWRAP_USE_DSA
+  gl(NamedFramebufferRenderbuffer(expose(), GLenum(attachment),
+                                  GL_RENDERBUFFER, render_buffer.expose()));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferRenderbuffer(GLenum(FBO_TYPE), GLenum(attachment),
                              GL_RENDERBUFFER, render_buffer.expose()));
+#endif
 }
 #endif  // glFramebufferRenderbuffer
 
@@ -96,9 +109,14 @@ void FramebufferObject<FBO_TYPE>::attachTexture(
     FramebufferAttachment attachment,
     const Texture1D& texture,
     GLuint level) {
+#if OGLWRAP_USE_DSA
+  gl(NamedFramebufferTexture(expose(), GLenum(attachment),
+                             texture.expose(), level));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferTexture1D(GLenum(FBO_TYPE), GLenum(attachment), GL_TEXTURE_1D,
                           texture.expose(), level));
+#endif
 }
 #endif  // glFramebufferTexture1D
 
@@ -109,9 +127,14 @@ void FramebufferObject<FBO_TYPE>::attachTexture(
     FramebufferAttachment attachment,
     const Texture2DBase<texture_t>& texture,
     GLint level) {
+#if OGLWRAP_USE_DSA
+  gl(NamedFramebufferTexture(expose(), GLenum(attachment),
+                             texture.expose(), level));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferTexture2D(GLenum(FBO_TYPE), GLenum(attachment),
                           GLenum(texture_t), texture.expose(), level));
+#endif
 }
 #endif  // glFramebufferTexture2D
 
@@ -122,9 +145,16 @@ void FramebufferObject<FBO_TYPE>::attachTexture(
     TextureCubeTarget target,
     const TextureCube& texture,
     GLint level) {
+#if OGLWRAP_USE_DSA
+  // A cube map face is attached as a layer of the cube map.
+  gl(NamedFramebufferTextureLayer(expose(), GLenum(attachment),
+                                  texture.expose(), level,
+                                  TextureCube::faceIndex(target)));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferTexture2D(GLenum(FBO_TYPE), GLenum(attachment),
                           GLenum(target), texture.expose(), level));
+#endif
 }
 #endif  // glFramebufferTexture2D
 
@@ -133,9 +163,14 @@ template<FramebufferType FBO_TYPE>
 void FramebufferObject<FBO_TYPE>::attachTexture(
     FramebufferAttachment attachment, const Texture3D& texture,
     GLint level, GLint layer) {
+#if OGLWRAP_USE_DSA
+  gl(NamedFramebufferTextureLayer(expose(), GLenum(attachment),
+                                  texture.expose(), level, layer));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferTexture3D(GLenum(FBO_TYPE), GLenum(attachment), GL_TEXTURE_3D,
                           texture.expose(), level, layer));
+#endif
 }
 #endif  // glFramebufferTexture3D
 
@@ -145,9 +180,14 @@ template <TextureType texture_t>
 void FramebufferObject<FBO_TYPE>::attachTextureLayer(
     FramebufferAttachment attachment, const TextureBase<texture_t>& texture,
     GLint level, GLint layer) {
+#if OGLWRAP_USE_DSA
+  gl(NamedFramebufferTextureLayer(expose(), GLenum(attachment),
+                                  texture.expose(), level, layer));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(FramebufferTextureLayer(GLenum(FBO_TYPE), GLenum(attachment),
                              texture.expose(), level, layer));
+#endif
 }
 #endif  // glFramebufferTextureLayer
 
@@ -12,6 +12,9 @@
 
 #include "config.h"
 #include "enums/shader_type.h"
+#include "enums/texture_type.h"
+#include "context/binding_cache.h"
+#include "context/uniform_cache.h"
 
 #include "./define_internal_macros.h"
 
@@ -96,6 +99,12 @@ namespace globjects {
     ~Program() {
       if (ownership_) {
         gl(DeleteProgram(handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kProgram, handle_);
+      #endif
+      #if OGLWRAP_USE_UNIFORM_CACHE
+        UniformCache::Forget(handle_);
+      #endif
       }
     }
 
@@ -114,13 +123,20 @@ namespace globjects {
     }
 
     Buffer() {
+    #if OGLWRAP_USE_DSA
+      gl(CreateBuffers(1, &handle_));
+    #else
       gl(GenBuffers(1, &handle_));
+    #endif
       ownership_ = true;
     }
 
     ~Buffer() {
       if (ownership_) {
         gl(DeleteBuffers(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kBuffer, handle_);
+      #endif
       }
     }
 
@@ -139,13 +155,20 @@ namespace globjects {
     }
 
     Renderbuffer() {
+    #if OGLWRAP_USE_DSA
+      gl(CreateRenderbuffers(1, &handle_));
+    #else
       gl(GenRenderbuffers(1, &handle_));
+    #endif
       ownership_ = true;
     }
 
     ~Renderbuffer() {
       if (ownership_) {
         gl(DeleteRenderbuffers(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kRenderbuffer, handle_);
+      #endif
       }
     }
 
@@ -164,13 +187,20 @@ namespace globjects {
     }
 
     Framebuffer() {
+    #if OGLWRAP_USE_DSA
+      gl(CreateFramebuffers(1, &handle_));
+    #else
       gl(GenFramebuffers(1, &handle_));
+    #endif
       ownership_ = true;
     }
 
     ~Framebuffer() {
       if (ownership_) {
         gl(DeleteFramebuffers(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kFramebuffer, handle_);
+      #endif
       }
     }
 
@@ -196,6 +226,9 @@ namespace globjects {
     ~TransformFeedback() {
       if (ownership_) {
         gl(DeleteTransformFeedbacks(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kTransformFeedback, handle_);
+      #endif
       }
     }
 
@@ -221,6 +254,9 @@ namespace globjects {
     ~VertexArray() {
       if (ownership_) {
         gl(DeleteVertexArrays(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kVertexArray, handle_);
+      #endif
       }
     }
 
@@ -229,6 +265,38 @@ namespace globjects {
   };
 #endif
 
+#if OGLWRAP_DEFINE_EVERYTHING || \
+    (defined(glGenProgramPipelines) && defined(glDeleteProgramPipelines))
+  class ProgramPipeline : public glObject {
+   public:
+    explicit ProgramPipeline(GLuint handle) {
+      handle_ = handle;
+      ownership_ = false;
+    }
+
+    ProgramPipeline() {
+    #if OGLWRAP_USE_DSA
+      gl(CreateProgramPipelines(1, &handle_));
+    #else
+      gl(GenProgramPipelines(1, &handle_));
+    #endif
+      ownership_ = true;
+    }
+
+    ~ProgramPipeline() {
+      if (ownership_) {
+        gl(DeleteProgramPipelines(1, &handle_));
+      #if OGLWRAP_USE_BINDING_CACHE
+        BindingCache::Forget(BindingKind::kProgramPipeline, handle_);
+      #endif
+      }
+    }
+
+    ProgramPipeline(ProgramPipeline&&) noexcept = default;
+    ProgramPipeline& operator=(ProgramPipeline&&) noexcept = default;
+  };
+#endif
+
 class Texture : public glObject {
  public:
   explicit Texture(GLuint handle) {
@@ -241,9 +309,21 @@ class Texture : public glObject {
     ownership_ = true;
   }
 
+#if OGLWRAP_USE_DSA
+  /// Creates a texture that is already initialized for the given target.
+  /** @see glCreateTextures */
+  explicit Texture(TextureType texture_t) {
+    gl(CreateTextures(GLenum(texture_t), 1, &handle_));
+    ownership_ = true;
+  }
+#endif
+
   ~Texture() {
     if (ownership_) {
       gl(DeleteTextures(1, &handle_));
+    #if OGLWRAP_USE_BINDING_CACHE
+      BindingCache::Forget(BindingKind::kTexture, handle_);
+    #endif
     }
   }
 
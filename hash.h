@@ -0,0 +1,44 @@
+// Copyright (c) Tamas Csala
+
+/** @file hash.h
+    @brief Implements the hash function used by the caches.
+*/
+
+#ifndef OGLWRAP_HASH_H_
+#define OGLWRAP_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "./config.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// Returns the initial value of a 64 bit FNV-1a hash.
+inline std::uint64_t OGLWRAP_HashInit() {
+  return 14695981039346656037ull;
+}
+
+/// Mixes bytes into a 64 bit FNV-1a hash.
+inline std::uint64_t OGLWRAP_HashBytes(std::uint64_t hash, const void *data,
+                                       size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+/// Mixes the 8 bytes of a value (from the lowest one) into a 64 bit FNV-1a
+/// hash, so the hash doesn't depend on the platform's byte order.
+inline std::uint64_t OGLWRAP_HashValue(std::uint64_t hash,
+                                       std::uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 1099511628211ull;
+  }
+  return hash;
+}
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_HASH_H_
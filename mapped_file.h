@@ -0,0 +1,113 @@
+// Copyright (c) Tamas Csala
+
+/** @file mapped_file.h
+    @brief Implements a read-only memory mapped file.
+*/
+
+#ifndef OGLWRAP_MAPPED_FILE_H_
+#define OGLWRAP_MAPPED_FILE_H_
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#include "./config.h"
+
+/// If true, MappedFile uses mmap, otherwise it reads the whole file.
+#ifndef OGLWRAP_USE_MMAP
+  #if defined(__unix__) || defined(__APPLE__)
+    #define OGLWRAP_USE_MMAP 1
+  #else
+    #define OGLWRAP_USE_MMAP 0
+  #endif
+#endif
+
+#if OGLWRAP_USE_MMAP
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// The read-only contents of a file, mapped into memory.
+/** The file isn't copied, its pages are read by the OS when they are first
+  * touched. On platforms without mmap, the file is read into memory instead. */
+class MappedFile {
+ public:
+  /// Maps a file.
+  /** Throws std::runtime_error if the file can't be opened. */
+  explicit MappedFile(const std::string& path) {
+  #if OGLWRAP_USE_MMAP
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      throw std::runtime_error("File '" + path + "' not found.");
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ != 0) {
+      void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("File '" + path + "' can't be mapped.");
+      }
+      data_ = static_cast<const char*>(mapping);
+    }
+    close(fd);
+  #else
+    std::ifstream file(path.c_str(), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+      throw std::runtime_error("File '" + path + "' not found.");
+    }
+    contents_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(contents_.data(), contents_.size());
+    size_ = contents_.size();
+    data_ = contents_.data();
+  #endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Moves a mapping.
+  MappedFile(MappedFile&& other) noexcept
+      : data_(other.data_), size_(other.size_) {
+  #if !OGLWRAP_USE_MMAP
+    contents_.swap(other.contents_);
+  #endif
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+
+  ~MappedFile() {
+  #if OGLWRAP_USE_MMAP
+    if (data_) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+  #endif
+  }
+
+  /// Returns the contents of the file (nullptr if it's empty).
+  const char* data() const { return data_; }
+
+  /// Returns the size of the file in bytes.
+  size_t size() const { return size_; }
+
+ private:
+  const char *data_ = nullptr;
+  size_t size_ = 0;
+
+#if !OGLWRAP_USE_MMAP
+  std::vector<char> contents_;
+#endif
+};
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_MAPPED_FILE_H_
@@ -35,6 +35,14 @@
   #include "./texture.h"
   #include "./framebuffer.h"
   #include "./transform_feedback.h"
+  #include "./ring_buffer.h"
+  #include "./pipeline_state.h"
+  #include "./uniform_block.h"
+  #include "./transient_allocator.h"
+  #include "./program_binary_cache.h"
+  #include "./shader_variant_cache.h"
+  #include "./shader_watcher.h"
+  #include "./vertex_layout.h"
   #include "shapes/cube_shape.h"
   #include "shapes/sphere_shape.h"
   #include "shapes/rectangle_shape.h"
@@ -0,0 +1,404 @@
+// Copyright (c) Tamas Csala
+
+/** @file pipeline_state.h
+    @brief Implements immutable pipeline state objects, applied as diffs.
+*/
+
+#ifndef OGLWRAP_PIPELINE_STATE_H_
+#define OGLWRAP_PIPELINE_STATE_H_
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+#include "./config.h"
+#include "./program.h"
+#include "./vertex_array.h"
+#include "./context/binding.h"
+#include "./context/blending.h"
+#include "./context/buffer_masking.h"
+#include "./context/capabilities.h"
+#include "./context/depth_test.h"
+#include "./context/rasterization.h"
+#include "./context/scissor_test.h"
+#include "./context/stencil_test.h"
+#include "./context/viewport_ops.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// A bundle of the state that is needed for a draw call.
+/** A PipelineState is immutable, it is described once, when it's created.
+  * The state is split into groups (blending, depth, stencil, rasterization,
+  * viewport and the rest of the capabilities), and every group is hashed at
+  * construction. Applying a state compares its groups to the groups of the
+  * previously applied PipelineState, and only calls the setters for the groups
+  * that are different (two groups with different hashes differ in a single
+  * comparison). The setters themselves go through the StateCache, so the
+  * individual values that didn't change are skipped too.
+  *
+  * The diff is computed against the last applied PipelineState, so if the
+  * state is changed through the individual setters between two apply() calls,
+  * Invalidate() has to be called, to make the next apply() set everything. */
+class PipelineState {
+ public:
+  /// The state of the blending.
+  struct BlendState {
+    bool enabled = false;
+    BlendFunction src_rgb = BlendFunction::kOne;
+    BlendFunction dst_rgb = BlendFunction::kZero;
+    BlendFunction src_alpha = BlendFunction::kOne;
+    BlendFunction dst_alpha = BlendFunction::kZero;
+    enums::BlendEquation equation_rgb = enums::BlendEquation::kFuncAdd;
+    enums::BlendEquation equation_alpha = enums::BlendEquation::kFuncAdd;
+    glm::vec4 color = glm::vec4(0.0f);
+    bool color_mask[4] = {true, true, true, true};
+
+    bool operator==(const BlendState& other) const {
+      return enabled == other.enabled &&
+             src_rgb == other.src_rgb && dst_rgb == other.dst_rgb &&
+             src_alpha == other.src_alpha && dst_alpha == other.dst_alpha &&
+             equation_rgb == other.equation_rgb &&
+             equation_alpha == other.equation_alpha &&
+             color == other.color &&
+             color_mask[0] == other.color_mask[0] &&
+             color_mask[1] == other.color_mask[1] &&
+             color_mask[2] == other.color_mask[2] &&
+             color_mask[3] == other.color_mask[3];
+    }
+  };
+
+  /// The state of the depth test.
+  struct DepthState {
+    bool test = false;
+    CompareFunc func = CompareFunc::kLess;
+    bool write_mask = true;
+
+    bool operator==(const DepthState& other) const {
+      return test == other.test && func == other.func &&
+             write_mask == other.write_mask;
+    }
+  };
+
+  /// The stencil state of one face.
+  struct StencilFaceState {
+    CompareFunc func = CompareFunc::kAlways;
+    GLint ref = 0;
+    GLuint mask = ~GLuint(0);
+    StencilOperation sfail = StencilOperation::kKeep;
+    StencilOperation dfail = StencilOperation::kKeep;
+    StencilOperation dpass = StencilOperation::kKeep;
+    GLuint write_mask = ~GLuint(0);
+
+    bool operator==(const StencilFaceState& other) const {
+      return func == other.func && ref == other.ref && mask == other.mask &&
+             sfail == other.sfail && dfail == other.dfail &&
+             dpass == other.dpass && write_mask == other.write_mask;
+    }
+  };
+
+  /// The state of the stencil test.
+  struct StencilState {
+    bool test = false;
+    StencilFaceState front;
+    StencilFaceState back;
+
+    bool operator==(const StencilState& other) const {
+      return test == other.test && front == other.front && back == other.back;
+    }
+  };
+
+  /// The state of the rasterization.
+  struct RasterizationState {
+    bool cull = false;
+    Face cull_face = Face::kBack;
+    FaceOrientation front_face = FaceOrientation::kCcw;
+    PolyMode polygon_mode = PolyMode::kFill;
+    bool polygon_offset = false;
+    GLfloat polygon_offset_factor = 0.0f;
+    GLfloat polygon_offset_units = 0.0f;
+    GLfloat line_width = 1.0f;
+
+    bool operator==(const RasterizationState& other) const {
+      return cull == other.cull && cull_face == other.cull_face &&
+             front_face == other.front_face &&
+             polygon_mode == other.polygon_mode &&
+             polygon_offset == other.polygon_offset &&
+             polygon_offset_factor == other.polygon_offset_factor &&
+             polygon_offset_units == other.polygon_offset_units &&
+             line_width == other.line_width;
+    }
+  };
+
+  /// The viewport and the scissor box.
+  struct ViewportState {
+    /// The viewport as (x, y, width, height). If the width or the height is
+    /// zero, the viewport is not part of the pipeline state.
+    glm::ivec4 viewport = glm::ivec4(0);
+    bool scissor_test = false;
+    /// The scissor box as (left, bottom, width, height).
+    glm::ivec4 scissor = glm::ivec4(0);
+
+    bool operator==(const ViewportState& other) const {
+      return viewport == other.viewport &&
+             scissor_test == other.scissor_test && scissor == other.scissor;
+    }
+  };
+
+  /// Everything that a PipelineState consists of.
+  struct Description {
+    /// The program to use, or nullptr to leave the current one.
+    const Program* program = nullptr;
+    /// The vertex array to bind, or nullptr to leave the current one.
+    const VertexArray* vertex_array = nullptr;
+    BlendState blend;
+    DepthState depth;
+    StencilState stencil;
+    RasterizationState rasterization;
+    ViewportState viewport;
+    /// Any other capability that should be enabled or disabled.
+    std::vector<std::pair<Capability, bool>> capabilities;
+  };
+
+  /// Creates the pipeline state, and hashes its groups.
+  explicit PipelineState(const Description& desc)
+      : desc_(desc)
+      , blend_hash_(Hash(desc.blend))
+      , depth_hash_(Hash(desc.depth))
+      , stencil_hash_(Hash(desc.stencil))
+      , rasterization_hash_(Hash(desc.rasterization))
+      , viewport_hash_(Hash(desc.viewport))
+      , capabilities_hash_(Hash(desc.capabilities)) {}
+
+  PipelineState(const PipelineState&) = default;
+  PipelineState(PipelineState&&) = default;
+
+  ~PipelineState() {
+    if (LastApplied() == this) {
+      LastApplied() = nullptr;
+    }
+  }
+
+  /// Returns the description of the state.
+  const Description& description() const { return desc_; }
+
+  /// Sets the state, that differs from the previously applied PipelineState.
+  void apply() const {
+    const PipelineState* prev = LastApplied();
+    if (prev == this) {
+      return;
+    }
+
+    if (desc_.program && (!prev || prev->desc_.program != desc_.program)) {
+      Use(*desc_.program);
+    }
+    if (desc_.vertex_array &&
+        (!prev || prev->desc_.vertex_array != desc_.vertex_array)) {
+      Bind(*desc_.vertex_array);
+    }
+    if (!prev || Differs(prev->blend_hash_, prev->desc_.blend,
+                         blend_hash_, desc_.blend)) {
+      ApplyBlend();
+    }
+    if (!prev || Differs(prev->depth_hash_, prev->desc_.depth,
+                         depth_hash_, desc_.depth)) {
+      ApplyDepth();
+    }
+    if (!prev || Differs(prev->stencil_hash_, prev->desc_.stencil,
+                         stencil_hash_, desc_.stencil)) {
+      ApplyStencil();
+    }
+    if (!prev || Differs(prev->rasterization_hash_, prev->desc_.rasterization,
+                         rasterization_hash_, desc_.rasterization)) {
+      ApplyRasterization();
+    }
+    if (!prev || Differs(prev->viewport_hash_, prev->desc_.viewport,
+                         viewport_hash_, desc_.viewport)) {
+      ApplyViewport();
+    }
+    if (!prev || Differs(prev->capabilities_hash_, prev->desc_.capabilities,
+                         capabilities_hash_, desc_.capabilities)) {
+      for (const auto& cap : desc_.capabilities) {
+        SetCapability(cap.first, cap.second);
+      }
+    }
+
+    LastApplied() = this;
+  }
+
+  /// Forgets the last applied state, the next apply() will set everything.
+  static void Invalidate() {
+    LastApplied() = nullptr;
+  }
+
+ private:
+  const Description desc_;
+  const size_t blend_hash_;
+  const size_t depth_hash_;
+  const size_t stencil_hash_;
+  const size_t rasterization_hash_;
+  const size_t viewport_hash_;
+  const size_t capabilities_hash_;
+
+  PipelineState& operator=(const PipelineState&) = delete;
+
+  static const PipelineState*& LastApplied() {
+    static const PipelineState* last_applied = nullptr;
+    return last_applied;
+  }
+
+  template <typename T>
+  static bool Differs(size_t hash_a, const T& a, size_t hash_b, const T& b) {
+    return hash_a != hash_b || !(a == b);
+  }
+
+  template <typename T>
+  static void HashCombine(size_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  template <typename Enum>
+  static void HashCombineEnum(size_t& seed, Enum value) {
+    HashCombine(seed, GLenum(value));
+  }
+
+  template <typename Vec4>
+  static void HashCombineVec4(size_t& seed, const Vec4& value) {
+    for (int i = 0; i < 4; ++i) {
+      HashCombine(seed, value[i]);
+    }
+  }
+
+  static size_t Hash(const BlendState& state) {
+    size_t seed = 0;
+    HashCombine(seed, state.enabled);
+    HashCombineEnum(seed, state.src_rgb);
+    HashCombineEnum(seed, state.dst_rgb);
+    HashCombineEnum(seed, state.src_alpha);
+    HashCombineEnum(seed, state.dst_alpha);
+    HashCombineEnum(seed, state.equation_rgb);
+    HashCombineEnum(seed, state.equation_alpha);
+    HashCombineVec4(seed, state.color);
+    HashCombineVec4(seed, state.color_mask);
+    return seed;
+  }
+
+  static size_t Hash(const DepthState& state) {
+    size_t seed = 0;
+    HashCombine(seed, state.test);
+    HashCombineEnum(seed, state.func);
+    HashCombine(seed, state.write_mask);
+    return seed;
+  }
+
+  static void HashCombineFace(size_t& seed, const StencilFaceState& state) {
+    HashCombineEnum(seed, state.func);
+    HashCombine(seed, state.ref);
+    HashCombine(seed, state.mask);
+    HashCombineEnum(seed, state.sfail);
+    HashCombineEnum(seed, state.dfail);
+    HashCombineEnum(seed, state.dpass);
+    HashCombine(seed, state.write_mask);
+  }
+
+  static size_t Hash(const StencilState& state) {
+    size_t seed = 0;
+    HashCombine(seed, state.test);
+    HashCombineFace(seed, state.front);
+    HashCombineFace(seed, state.back);
+    return seed;
+  }
+
+  static size_t Hash(const RasterizationState& state) {
+    size_t seed = 0;
+    HashCombine(seed, state.cull);
+    HashCombineEnum(seed, state.cull_face);
+    HashCombineEnum(seed, state.front_face);
+    HashCombineEnum(seed, state.polygon_mode);
+    HashCombine(seed, state.polygon_offset);
+    HashCombine(seed, state.polygon_offset_factor);
+    HashCombine(seed, state.polygon_offset_units);
+    HashCombine(seed, state.line_width);
+    return seed;
+  }
+
+  static size_t Hash(const ViewportState& state) {
+    size_t seed = 0;
+    HashCombineVec4(seed, state.viewport);
+    HashCombine(seed, state.scissor_test);
+    HashCombineVec4(seed, state.scissor);
+    return seed;
+  }
+
+  static size_t Hash(const std::vector<std::pair<Capability, bool>>& caps) {
+    size_t seed = 0;
+    for (const auto& cap : caps) {
+      HashCombineEnum(seed, cap.first);
+      HashCombine(seed, cap.second);
+    }
+    return seed;
+  }
+
+  void ApplyBlend() const {
+    const BlendState& blend = desc_.blend;
+    SetCapability(Capability::kBlend, blend.enabled);
+    BlendFuncSeparate(blend.src_rgb, blend.dst_rgb,
+                      blend.src_alpha, blend.dst_alpha);
+    BlendEquationSeparate(blend.equation_rgb, blend.equation_alpha);
+    BlendColor(blend.color);
+    ColorMask(blend.color_mask[0], blend.color_mask[1],
+              blend.color_mask[2], blend.color_mask[3]);
+  }
+
+  void ApplyDepth() const {
+    const DepthState& depth = desc_.depth;
+    SetCapability(Capability::kDepthTest, depth.test);
+    DepthFunc(depth.func);
+    DepthMask(depth.write_mask);
+  }
+
+  void ApplyStencil() const {
+    const StencilState& stencil = desc_.stencil;
+    SetCapability(Capability::kStencilTest, stencil.test);
+    StencilFuncSeparate(Face::kFront, stencil.front.func,
+                        stencil.front.ref, stencil.front.mask);
+    StencilFuncSeparate(Face::kBack, stencil.back.func,
+                        stencil.back.ref, stencil.back.mask);
+    StencilOpSeparate(Face::kFront, stencil.front.sfail,
+                      stencil.front.dfail, stencil.front.dpass);
+    StencilOpSeparate(Face::kBack, stencil.back.sfail,
+                      stencil.back.dfail, stencil.back.dpass);
+    StencilMask(Face::kFront, stencil.front.write_mask);
+    StencilMask(Face::kBack, stencil.back.write_mask);
+  }
+
+  void ApplyRasterization() const {
+    const RasterizationState& raster = desc_.rasterization;
+    SetCapability(Capability::kCullFace, raster.cull);
+    CullFace(raster.cull_face);
+    FrontFace(raster.front_face);
+    PolygonMode(raster.polygon_mode);
+    SetCapability(Capability::kPolygonOffsetFill, raster.polygon_offset);
+    PolygonOffset(raster.polygon_offset_factor, raster.polygon_offset_units);
+    LineWidth(raster.line_width);
+  }
+
+  void ApplyViewport() const {
+    const ViewportState& viewport = desc_.viewport;
+    if (viewport.viewport.z != 0 && viewport.viewport.w != 0) {
+      Viewport(viewport.viewport.x, viewport.viewport.y,
+               viewport.viewport.z, viewport.viewport.w);
+    }
+    SetCapability(Capability::kScissorTest, viewport.scissor_test);
+    if (viewport.scissor_test) {
+      Scissor(viewport.scissor.x, viewport.scissor.y,
+              viewport.scissor.z, viewport.scissor.w);
+    }
+  }
+};
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_PIPELINE_STATE_H_
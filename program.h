@@ -9,6 +9,7 @@
 
 #include <vector>
 #include "./shader.h"
+#include "./program_reflection.h"
 
 #include "./define_internal_macros.h"
 
@@ -22,7 +23,9 @@ namespace OGLWRAP_NAMESPACE_NAME {
  */
 class Program {
  public:
-  enum State { kNotLinked, kLinkFailure, kLinkSuccessful, kValidationFailure };
+  enum State {
+    kNotLinked, kLinking, kLinkFailure, kLinkSuccessful, kValidationFailure
+  };
 
   /// Creates an empty program object.
   Program() = default;
@@ -44,6 +47,9 @@ class Program {
         state_ = kNotLinked;
       } else {
         state_ = kLinkSuccessful;
+      #if OGLWRAP_USE_PROGRAM_REFLECTION
+        reflection_.reflect(program_);
+      #endif
       }
     }
   }
@@ -87,12 +93,17 @@ class Program {
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glAttachShader)
   /// Attaches a shader to this program object.
-  /** @param shader Specifies the shader object that is to be attached.
+  /** Compiles the shader, if it wasn't compiled yet. If its compilation was
+    * started with compileAsync(), it doesn't wait for it to finish.
+    * @param shader Specifies the shader object that is to be attached.
     * @see glAttachShader */
   Program& attachShader(const Shader& shader) {
     if (state_ == kNotLinked) {
-      shader.compile();
+      if (shader.state() != Shader::kCompiling) {
+        shader.compile();
+      }
       shaders_.push_back(shader.expose());
+      stages_ |= OGLWRAP_ShaderStageBit(shader.shader_type());
 
       #if OGLWRAP_DEBUG
         filenames_.push_back(shader.source_file_name());
@@ -148,62 +159,72 @@ class Program {
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glLinkProgram)
   /// Links the program and checks for error if OGLWRAP_DEBUG is defined.
   /** If the linking fails, it throws an
-    * std::runtime_error containing the linking info.
+    * std::runtime_error containing the linking info. If the linking was
+    * started with linkAsync(), it waits for it to finish.
     * @see glLinkProgram, glGetProgramiv, glGetProgramInfoLog */
   virtual const Program& link() {
     if (state_ == kNotLinked) {
-      gl(LinkProgram(program_));
-
-      GLint status;
-      gl(GetProgramiv(program_, GL_LINK_STATUS, &status));
-      if (status == GL_FALSE) {
-        state_ = kLinkFailure;
-      } else {
-        state_ = kLinkSuccessful;
-      }
+      linkAsync();
+    }
+    if (state_ == kLinking) {
+      finishLink();
+    }
 
-      #if OGLWRAP_DEBUG
-      if (status == GL_FALSE) {
-        GLint info_log_length;
-        gl(GetProgramiv(program_, GL_INFO_LOG_LENGTH, &info_log_length));
+    return *this;
+  }
 
-        std::unique_ptr<GLchar> str_info_log{ new GLchar[info_log_length + 1] };
-        gl(GetProgramInfoLog(program_, info_log_length, NULL, str_info_log.get()));
-        std::stringstream str;
-        str << "OpenGL failed to link the following shaders together: " << std::endl;
-        str << getShaderNames() << std::endl;
-        str << "The error message:\n" << str_info_log.get();
+  /// Starts linking the program, without waiting for the result.
+  /** This lets the driver compile and link many programs in parallel (with
+    * ParallelShaderCompile), if all the compiles and links are submitted
+    * before any of the results are queried:
+    * @code
+    *   for (auto& shader : shaders) { shader.compileAsync(); }
+    *   for (auto& prog : programs) { prog.attachShaders(...).linkAsync(); }
+    *   // Later, like once per frame:
+    *   if (prog.ready()) { draw with prog }
+    * @endcode
+    * The linking is finished by link() or ready().
+    * @see glLinkProgram */
+  Program& linkAsync() {
+    if (state_ == kNotLinked) {
+      gl(LinkProgram(program_));
+    #if OGLWRAP_USE_UNIFORM_CACHE
+      // Linking resets the uniforms (and might move their locations).
+      UniformCache::Forget(program_);
+    #endif
+      state_ = kLinking;
+    }
+    return *this;
+  }
 
-        OGLWRAP_PRINT_ERROR("Program link failure", str.str());
-      } else {
-        GLint info_log_length;
-        gl(GetProgramiv(program_, GL_INFO_LOG_LENGTH, &info_log_length));
-
-        if (info_log_length > 1) {
-          std::unique_ptr<GLchar> str_info_log{ new GLchar[info_log_length + 1] };
-          gl(GetProgramInfoLog(program_, info_log_length, NULL, str_info_log.get()));
-          std::stringstream str;
-          str << "There was a warning when linking the following shaders together: " << std::endl;
-          str << getShaderNames() << std::endl;
-          str << "The warning message:\n" << str_info_log.get();
-
-          OGLWRAP_PRINT_ERROR("Program link warning", str.str());
+  /// Returns true if the program is linked (or failed to link), and false if
+  /// the driver is still working on it.
+  /** It can only tell that without waiting if the ParallelShaderCompile
+    * extension is supported, otherwise it waits for the linking to finish.
+    * Like link(), it reports the errors of the linking when it finishes.
+    * @see GL_COMPLETION_STATUS_KHR */
+  bool ready() {
+    if (state_ == kLinking) {
+    #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_COMPLETION_STATUS_KHR)
+      if (ParallelShaderCompile::IsSupported()) {
+        GLint completed = GL_TRUE;
+        gl(GetProgramiv(program_, GL_COMPLETION_STATUS_KHR, &completed));
+        if (completed == GL_FALSE) {
+          return false;
         }
-
       }
-      #endif  // OGLWRAP_DEBUG
+    #endif
+      finishLink();
     }
-
-    return *this;
+    return state_ != kNotLinked;
   }
-
 #endif  // glLinkProgram
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glValidateProgram)
   /// Validates the program if OGLWRAP_DEBUG is defined.
   /** @see glLinkProgram, glGetProgramiv, glGetProgramInfoLog */
   void validate() {
-    if (state_ == kNotLinked) {
+    if (state_ == kNotLinked || state_ == kLinking) {
       link();
     }
 
@@ -253,6 +274,152 @@ class Program {
     return state_;
   }
 
+  /// Returns the active resources of the program.
+  /** It is only filled if OGLWRAP_USE_PROGRAM_REFLECTION is true. */
+  const ProgramReflection& reflection() const {
+    return reflection_;
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glGetUniformLocation)
+  /// Returns the location of a uniform, or -1 if it isn't active.
+  /** Uses the reflection table if it is available, and glGetUniformLocation
+    * if it isn't.
+    * @see glGetUniformLocation */
+  GLint uniformLocation(const char *name) const {
+  #if OGLWRAP_USE_PROGRAM_REFLECTION
+    if (state_ == kLinkSuccessful || state_ == kValidationFailure) {
+      return reflection_.uniformLocation(name);
+    }
+  #endif
+    GLint location = gl(GetUniformLocation(program_, name));
+    return location;
+  }
+
+  /// Returns the location of a uniform, or -1 if it isn't active.
+  /** Looks the name up by its precomputed hash in the reflection table if it
+    * is available, and uses glGetUniformLocation if it isn't.
+    * @see glGetUniformLocation */
+  GLint uniformLocation(const UniformName& name) const {
+  #if OGLWRAP_USE_PROGRAM_REFLECTION
+    if (state_ == kLinkSuccessful || state_ == kValidationFailure) {
+      const ProgramReflection::Resource* resource = reflection_.find(
+          ProgramReflection::kUniform, name.str, name.length, name.hash);
+      if (resource) {
+        return resource->location;
+      }
+      // It might be an element of an array, like "lights[2]".
+      return reflection_.uniformLocation(name.str);
+    }
+  #endif
+    return uniformLocation(name.str);
+  }
+#endif  // glGetUniformLocation
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glGetAttribLocation)
+  /// Returns the location of an attribute, or -1 if it isn't active.
+  /** Uses the reflection table if it is available, and glGetAttribLocation
+    * if it isn't.
+    * @see glGetAttribLocation */
+  GLint attribLocation(const char *name) const {
+  #if OGLWRAP_USE_PROGRAM_REFLECTION
+    if (state_ == kLinkSuccessful || state_ == kValidationFailure) {
+      return reflection_.attribLocation(name);
+    }
+  #endif
+    GLint location = gl(GetAttribLocation(program_, name));
+    return location;
+  }
+#endif  // glGetAttribLocation
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramParameteri)
+  /// Marks the program as separable, so its stages can be combined with the
+  /// stages of other programs in a ProgramPipeline. It has to be called
+  /// before link().
+  /** @see glProgramParameteri, GL_PROGRAM_SEPARABLE */
+  Program& separable(bool is_separable = true) {
+    gl(ProgramParameteri(program_, GL_PROGRAM_SEPARABLE,
+                         is_separable ? GL_TRUE : GL_FALSE));
+    separable_ = is_separable;
+    return *this;
+  }
+
+  /// Hints the driver that binary() will be called after the program was
+  /// linked. It has to be called before link().
+  /** @see glProgramParameteri, GL_PROGRAM_BINARY_RETRIEVABLE_HINT */
+  void binaryRetrievableHint() {
+    gl(ProgramParameteri(program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                         GL_TRUE));
+  }
+#endif  // glProgramParameteri
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetProgramBinary) && \
+    defined(glProgramBinary))
+  /// Returns the driver specific binary representation of the linked program.
+  /** @param format - Returns the format of the binary.
+    * @see glGetProgramBinary */
+  std::vector<unsigned char> binary(GLenum *format) const {
+    GLint length = 0;
+    gl(GetProgramiv(program_, GL_PROGRAM_BINARY_LENGTH, &length));
+    std::vector<unsigned char> data(length);
+    if (length > 0) {
+      gl(GetProgramBinary(program_, length, nullptr, format, data.data()));
+    }
+    return data;
+  }
+
+  /// Loads a binary returned by binary() instead of linking the program.
+  /** The driver can reject binaries that were made by a different driver
+    * version or hardware. The program stays unlinked in that case, so the
+    * shaders can still be attached and linked.
+    * @return true if the program was loaded.
+    * @see glProgramBinary */
+  bool loadBinary(GLenum format, const void *binary, GLsizei length) {
+    if (state_ != kNotLinked) {
+      throw std::logic_error{
+        "Program::loadBinary called on an already linked program."};
+    }
+    gl(ProgramBinary(program_, format, binary, length));
+  #if OGLWRAP_USE_UNIFORM_CACHE
+    UniformCache::Forget(program_);
+  #endif
+
+    GLint status;
+    gl(GetProgramiv(program_, GL_LINK_STATUS, &status));
+    if (status == GL_FALSE) {
+      return false;
+    }
+    state_ = kLinkSuccessful;
+  #if OGLWRAP_USE_PROGRAM_REFLECTION
+    reflection_.reflect(program_);
+  #endif
+    return true;
+  }
+#endif  // glGetProgramBinary && glProgramBinary
+
+#if OGLWRAP_DEBUG
+  /// Stores the name of a shader for the error messages, if the program was
+  /// made without attaching it (like when it was loaded from a binary).
+  void addShaderName(const std::string& name) {
+    filenames_.push_back(name);
+  }
+#endif
+
+  /// Returns the stages of the attached shaders (like GL_VERTEX_SHADER_BIT).
+  GLbitfield stages() const {
+    return stages_;
+  }
+
+  /// Stores the stages of shaders that weren't attached (like when the
+  /// program was loaded from a binary), for ProgramPipeline::useStages().
+  void addStages(GLbitfield stages) {
+    stages_ |= stages;
+  }
+
+  /// Returns true if separable() was called for the program.
+  bool is_separable() const {
+    return separable_;
+  }
+
   /// Returns the C OpenGL handle for the program.
   const glObject& expose() const {
     return program_;
@@ -261,6 +428,8 @@ class Program {
  private:
   globjects::Program program_;  // The C OpenGL handle for the program.
   std::vector<GLuint> shaders_;  // IDs of the shaders attached to the program
+  GLbitfield stages_ = 0;  // The stages of the attached shaders.
+  bool separable_ = false;  // If GL_PROGRAM_SEPARABLE was set.
 
   #if OGLWRAP_DEBUG
     /// The names of the shaders are stored to help debugging.
@@ -268,6 +437,70 @@ class Program {
   #endif
 
   mutable State state_ = kNotLinked;
+
+  /// The active resources, filled at link time.
+  ProgramReflection reflection_;
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glLinkProgram)
+  /// Waits for the linking started by linkAsync(), and reports its errors.
+  void finishLink() {
+    GLint status;
+    gl(GetProgramiv(program_, GL_LINK_STATUS, &status));
+    if (status == GL_FALSE) {
+      state_ = kLinkFailure;
+    } else {
+      state_ = kLinkSuccessful;
+    #if OGLWRAP_USE_PROGRAM_REFLECTION
+      reflection_.reflect(program_);
+    #endif
+    }
+
+    #if OGLWRAP_DEBUG
+    if (status == GL_FALSE) {
+      GLint info_log_length;
+      gl(GetProgramiv(program_, GL_INFO_LOG_LENGTH, &info_log_length));
+
+      std::unique_ptr<GLchar> str_info_log{ new GLchar[info_log_length + 1] };
+      gl(GetProgramInfoLog(program_, info_log_length, NULL, str_info_log.get()));
+      std::stringstream str;
+      str << "OpenGL failed to link the following shaders together: " << std::endl;
+      str << getShaderNames() << std::endl;
+      str << "The error message:\n" << str_info_log.get();
+
+      // The compile errors of the shaders that were compiled asynchronously,
+      // and so weren't reported yet.
+      for (GLuint shader : shaders_) {
+        GLint compiled = GL_TRUE;
+        gl(GetShaderiv(shader, GL_COMPILE_STATUS, &compiled));
+        if (compiled == GL_FALSE) {
+          GLint length;
+          gl(GetShaderiv(shader, GL_INFO_LOG_LENGTH, &length));
+          std::unique_ptr<GLchar[]> shader_log{ new GLchar[length + 1] };
+          gl(GetShaderInfoLog(shader, length, nullptr, shader_log.get()));
+          str << "\nThe compile error of a shader:\n" << shader_log.get();
+        }
+      }
+
+      OGLWRAP_PRINT_ERROR("Program link failure", str.str());
+    } else {
+      GLint info_log_length;
+      gl(GetProgramiv(program_, GL_INFO_LOG_LENGTH, &info_log_length));
+
+      if (info_log_length > 1) {
+        std::unique_ptr<GLchar> str_info_log{ new GLchar[info_log_length + 1] };
+        gl(GetProgramInfoLog(program_, info_log_length, NULL, str_info_log.get()));
+        std::stringstream str;
+        str << "There was a warning when linking the following shaders together: " << std::endl;
+        str << getShaderNames() << std::endl;
+        str << "The warning message:\n" << str_info_log.get();
+
+        OGLWRAP_PRINT_ERROR("Program link warning", str.str());
+      }
+
+    }
+    #endif  // OGLWRAP_DEBUG
+  }
+#endif  // glLinkProgram
 };
 
 #endif  // glCreateProgram
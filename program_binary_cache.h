@@ -0,0 +1,230 @@
+// Copyright (c) Tamas Csala
+
+/** @file program_binary_cache.h
+    @brief Implements an on-disk cache of linked program binaries.
+*/
+
+#ifndef OGLWRAP_PROGRAM_BINARY_CACHE_H_
+#define OGLWRAP_PROGRAM_BINARY_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "./config.h"
+#include "./hash.h"
+#include "./shader.h"
+#include "./program.h"
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetProgramBinary) && \
+    defined(glProgramBinary) && defined(glProgramParameteri) && \
+    defined(glGetString))
+/// Stores the binaries of the linked programs in a directory, and loads them
+/// instead of compiling and linking the shaders the next time.
+/** A binary is identified by the hash of the shaders' types and sources (as
+  * they were uploaded, after the ShaderSource macro insertions), and the
+  * driver's vendor, renderer and version strings, so a driver update or a
+  * changed shader never loads a stale binary. If the driver still rejects a
+  * binary, the program is compiled and linked normally, and the binary is
+  * replaced.
+  *
+  * The shaders are only compiled if the binary isn't in the cache, so they
+  * should only have their sources set (which is what their constructors do)
+  * when they are passed to link(). The directory has to exist. A separable
+  * program (see Program::separable()) has to be marked as separable before
+  * link() is called.
+  * @code
+  *   gl::ProgramBinaryCache cache{"shader_cache/"};
+  *   gl::VertexShader vs{"a.vert"};
+  *   gl::FragmentShader fs{"a.frag"};
+  *   gl::Program prog;
+  *   cache.link(prog, vs, fs);
+  * @endcode
+  * @see glGetProgramBinary, glProgramBinary */
+class ProgramBinaryCache {
+ public:
+  /// Creates a cache that stores its files in directory.
+  /** @param directory - The path of the directory, including the trailing
+    *                    slash (like "shader_cache/"). */
+  explicit ProgramBinaryCache(const std::string& directory)
+      : directory_(directory) { }
+
+  template<typename... Shaders>
+  /// Loads the program from the cache, or attaches the shaders, links the
+  /// program, and stores its binary.
+  /** @param program - An empty (not yet linked) program.
+    * @param shaders - The shaders of the program, with their sources set.
+    * @return The program. */
+  const Program& link(Program& program, const Shaders&... shaders) {
+    const Shader* shader_list[] = {&shaders...};
+    size_t shader_count = sizeof...(shaders);
+
+    std::uint64_t key = this->key(shader_list, shader_count,
+                                  program.is_separable());
+    if (key != 0 && load(program, key)) {
+      for (size_t i = 0; i < shader_count; ++i) {
+        program.addStages(
+            OGLWRAP_ShaderStageBit(shader_list[i]->shader_type()));
+      #if OGLWRAP_DEBUG
+        program.addShaderName(shader_list[i]->source_file_name());
+      #endif
+      }
+      ++hits_;
+      return program;
+    }
+
+    ++misses_;
+    for (size_t i = 0; i < shader_count; ++i) {
+      program.attachShader(*shader_list[i]);
+    }
+    program.binaryRetrievableHint();
+    program.link();
+    if (key != 0 && program.state() == Program::kLinkSuccessful) {
+      store(program, key);
+    }
+    return program;
+  }
+
+  /// Loads the binary with the key into program.
+  /** @return false if the binary isn't in the cache, or the driver rejected
+    *         it (the program stays unlinked then). */
+  bool load(Program& program, std::uint64_t key) const {
+    std::ifstream file(path(key).c_str(), std::ios::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, Magic(), sizeof(header.magic)) != 0 ||
+        header.key != key || header.length > kMaxBinarySize) {
+      return false;
+    }
+
+    std::vector<char> binary(header.length);
+    if (!file.read(binary.data(), binary.size())) {
+      return false;
+    }
+
+    return program.loadBinary(header.format, binary.data(),
+                              GLsizei(binary.size()));
+  }
+
+  /// Stores the binary of a linked program with the key.
+  /** The program should be linked after binaryRetrievableHint() was called.
+    * @return false if the file couldn't be written. */
+  bool store(const Program& program, std::uint64_t key) const {
+    // The padding of the header is written to the file too, so it's zeroed
+    // (aggregate initialization doesn't guarantee that).
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, Magic(), sizeof(header.magic));
+    header.key = key;
+    header.format = 0;
+    std::vector<unsigned char> binary = program.binary(&header.format);
+    header.length = binary.size();
+    if (binary.empty()) {
+      return false;
+    }
+
+    // Write to a temporary file first, so a crash can't leave a partial file.
+    std::string file_path = path(key), temp_path = file_path + ".tmp";
+    {
+      std::ofstream file(temp_path.c_str(), std::ios::binary);
+      if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+          !file.write(reinterpret_cast<const char*>(binary.data()),
+                      binary.size())) {
+        return false;
+      }
+    }
+    std::remove(file_path.c_str());
+    return std::rename(temp_path.c_str(), file_path.c_str()) == 0;
+  }
+
+  /// Returns the key of a program made of the shaders, or 0 if the source of a
+  /// shader is unknown.
+  /** @param separable - If the program is separable (see
+    *                    Program::separable()), its binary isn't shared with
+    *                    the non separable program made of the same shaders. */
+  std::uint64_t key(const Shader* const *shaders, size_t count,
+                    bool separable = false) {
+    std::uint64_t hash = driverHash();
+    if (separable) {
+      hash = OGLWRAP_HashValue(hash, GL_PROGRAM_SEPARABLE);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      if (shaders[i]->source_hash() == 0) {
+        return 0;
+      }
+      hash = OGLWRAP_HashValue(hash, shaders[i]->source_hash());
+    }
+    return hash == 0 ? 1 : hash;
+  }
+
+  /// Returns the path of the file that stores the binary with the key.
+  std::string path(std::uint64_t key) const {
+    char name[24];
+    std::snprintf(name, sizeof(name), "%016llx.bin",
+                  static_cast<unsigned long long>(key));
+    return directory_ + name;
+  }
+
+  /// Returns the number of programs that were loaded from the cache.
+  size_t hits() const { return hits_; }
+
+  /// Returns the number of programs that had to be linked.
+  size_t misses() const { return misses_; }
+
+ private:
+  struct Header {
+    char magic[8];
+    std::uint64_t key;
+    std::uint64_t length;
+    GLenum format;
+  };
+
+  /// The size of the largest binary that is loaded (larger ones are assumed
+  /// to be corrupted).
+  enum : std::uint64_t { kMaxBinarySize = 256 * 1024 * 1024 };
+
+  /// Identifies the cache files (8 bytes, without the terminating zero).
+  static const char* Magic() { return "OGLWPBIN"; }
+
+  std::string directory_;
+  std::uint64_t driver_hash_ = 0;
+  size_t hits_ = 0, misses_ = 0;
+
+  /// Returns the hash of the driver's vendor, renderer and version strings.
+  /** @see glGetString */
+  std::uint64_t driverHash() {
+    if (driver_hash_ == 0) {
+      std::uint64_t hash = OGLWRAP_HashInit();
+      const GLenum names[] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+      for (GLenum name : names) {
+        const GLubyte *str = gl(GetString(name));
+        if (str) {
+          size_t length = std::strlen(reinterpret_cast<const char*>(str));
+          hash = OGLWRAP_HashBytes(hash, str, length);
+        }
+        // The terminating zero separates the strings.
+        hash = OGLWRAP_HashBytes(hash, "", 1);
+      }
+      driver_hash_ = hash == 0 ? 1 : hash;
+    }
+    return driver_hash_;
+  }
+};
+#endif  // glGetProgramBinary && glProgramBinary && glProgramParameteri
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_PROGRAM_BINARY_CACHE_H_
@@ -0,0 +1,135 @@
+// Copyright (c) Tamas Csala
+
+/** @file program_pipeline.h
+    @brief Implements a wrapper for the program pipeline objects.
+*/
+
+#ifndef OGLWRAP_PROGRAM_PIPELINE_H_
+#define OGLWRAP_PROGRAM_PIPELINE_H_
+
+#include <string>
+#include <memory>
+#include <sstream>
+
+#include "./config.h"
+#include "./globjects.h"
+#include "./program.h"
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glGenProgramPipelines) && \
+    defined(glDeleteProgramPipelines) && defined(glUseProgramStages))
+/// Combines the stages of separable programs into a pipeline.
+/** With pipelines, every shader only has to be linked into a program once
+  * (N vertex and M fragment shaders need N + M programs instead of N * M),
+  * and any vertex stage can be combined with any fragment stage when drawing:
+  * @code
+  *   gl::Program vs_prog, fs_prog;
+  *   vs_prog.separable().attachShader(vs).link();
+  *   fs_prog.separable().attachShader(fs).link();
+  *   gl::ProgramPipeline pipeline;
+  *   pipeline.useStages(vs_prog).useStages(fs_prog);
+  *   gl::Bind(pipeline);
+  * @endcode
+  * A pipeline is only used for drawing if no program is in use, Bind() makes
+  * sure of that. The uniforms of the programs in a pipeline have to be set
+  * with glProgramUniform* (see OGLWRAP_USE_PROGRAM_UNIFORM), or the program
+  * has to be made the active program of the pipeline first.
+  * @see glGenProgramPipelines, glDeleteProgramPipelines */
+class ProgramPipeline {
+ public:
+  /// Creates a new program pipeline.
+  ProgramPipeline() = default;
+
+  /// Moves a program pipeline.
+  ProgramPipeline(ProgramPipeline&&) noexcept = default;
+
+  /// Moves a program pipeline.
+  ProgramPipeline& operator=(ProgramPipeline&&) noexcept = default;
+
+  /// Wrappes an existing OpenGL program pipeline into an oglwrap
+  /// ProgramPipeline.
+  explicit ProgramPipeline(GLuint handle) : pipeline_{handle} {}
+
+  /// Uses the stages of the shaders that were attached to a separable
+  /// program.
+  /** @see glUseProgramStages */
+  ProgramPipeline& useStages(const Program& program) {
+    return useStages(program, program.stages());
+  }
+
+  /// Uses some stages of a separable program.
+  /** @param program - A program linked with Program::separable().
+    * @param stages - The stages to use (like GL_VERTEX_SHADER_BIT), these
+    *                 stages are unset if the program doesn't have them.
+    * @see glUseProgramStages */
+  ProgramPipeline& useStages(const Program& program, GLbitfield stages) {
+    gl(UseProgramStages(pipeline_, stages, program.expose()));
+    return *this;
+  }
+
+  /// Unsets some stages of the pipeline.
+  /** @see glUseProgramStages */
+  ProgramPipeline& clearStages(GLbitfield stages) {
+    gl(UseProgramStages(pipeline_, stages, 0));
+    return *this;
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glActiveShaderProgram)
+  /// Sets the program that glUniform* calls modify while the pipeline is
+  /// bound.
+  /** @see glActiveShaderProgram */
+  ProgramPipeline& activeProgram(const Program& program) {
+    gl(ActiveShaderProgram(pipeline_, program.expose()));
+    return *this;
+  }
+#endif  // glActiveShaderProgram
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glValidateProgramPipeline) && \
+    defined(glGetProgramPipelineiv))
+  /// Validates the pipeline (checks if the interfaces of its stages match).
+  /** @return false if the validation failed (the info log is printed if
+    *         OGLWRAP_DEBUG is true).
+    * @see glValidateProgramPipeline */
+  bool validate() const {
+    GLint status;
+    gl(ValidateProgramPipeline(pipeline_));
+    gl(GetProgramPipelineiv(pipeline_, GL_VALIDATE_STATUS, &status));
+
+    #if OGLWRAP_DEBUG && (OGLWRAP_DEFINE_EVERYTHING || \
+        defined(glGetProgramPipelineInfoLog))
+    GLint info_log_length;
+    gl(GetProgramPipelineiv(pipeline_, GL_INFO_LOG_LENGTH, &info_log_length));
+    if (info_log_length > 1) {
+      std::unique_ptr<GLchar[]> str_info_log{ new GLchar[info_log_length + 1] };
+      gl(GetProgramPipelineInfoLog(pipeline_, info_log_length, nullptr,
+                                   str_info_log.get()));
+      std::stringstream str;
+      str << "The validation of a program pipeline "
+          << (status == GL_FALSE ? "failed" : "caused a warning")
+          << ":\n" << str_info_log.get();
+
+      OGLWRAP_PRINT_ERROR("Program pipeline validation", str.str());
+    }
+    #endif
+
+    return status != GL_FALSE;
+  }
+#endif  // glValidateProgramPipeline && glGetProgramPipelineiv
+
+  /// Returns the handle for the program pipeline.
+  const glObject& expose() const { return pipeline_; }
+
+ private:
+  /// The handle for the program pipeline.
+  globjects::ProgramPipeline pipeline_;
+};
+#endif  // glGenProgramPipelines && glDeleteProgramPipelines && ...
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_PROGRAM_PIPELINE_H_
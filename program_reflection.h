@@ -0,0 +1,411 @@
+// Copyright (c) Tamas Csala
+
+/** @file program_reflection.h
+    @brief Implements a table of a program's active resources.
+*/
+
+#ifndef OGLWRAP_PROGRAM_REFLECTION_H_
+#define OGLWRAP_PROGRAM_REFLECTION_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include "./config.h"
+#include "context/extensions.h"
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// The active uniforms, attributes, uniform blocks and storage blocks of a
+/// linked program.
+/** The resources are enumerated once (after the program is linked), and are
+  * stored sorted by the hash of their names, so looking them up doesn't call
+  * into the driver, and doesn't allocate memory. Arrays are stored by their
+  * base names, and "name[i]" is looked up as the location of the base plus i
+  * (the elements of an array uniform have consecutive locations).
+  *
+  * The Program fills it in link() if OGLWRAP_USE_PROGRAM_REFLECTION is true.
+  * The resources are enumerated with the program interface query if the
+  * context supports it (GL 4.3 or ARB_program_interface_query), and with
+  * glGetActiveUniform, glGetActiveAttrib and glGetActiveUniformBlockiv if it
+  * doesn't.
+  * @see glGetProgramInterfaceiv, glGetProgramResourceiv, glGetActiveUniform */
+class ProgramReflection {
+ public:
+  /// The kinds of the resources.
+  enum Interface {
+    kUniform,
+    kAttribute,
+    kUniformBlock,
+    kStorageBlock,
+    kInterfaceCount
+  };
+
+  /// An active resource of the program.
+  struct Resource {
+    /// The name of the resource (without the [0] for arrays).
+    std::string name;
+    /// The hash of the name.
+    std::uint32_t hash;
+    /// The location of a uniform or attribute, or the index of a block.
+    GLint location;
+    /// The type of a uniform or attribute (like GL_FLOAT_VEC3), 0 for blocks.
+    GLenum type;
+    /// The number of array elements of a uniform or attribute, or the size of
+    /// a block's data in bytes.
+    GLint size;
+  };
+
+  /// The value returned for the resources that aren't active.
+  enum : GLint { kInvalidLocation = -1 };
+
+  /// Returns the hash of a name (32 bit FNV-1a).
+  static std::uint32_t Hash(const char *name, size_t length) {
+    std::uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+      hash = (hash ^ static_cast<unsigned char>(name[i])) * 16777619u;
+    }
+    return hash;
+  }
+
+  /// Returns the hash of a name at compile time (the same as Hash()).
+  static constexpr std::uint32_t ConstHash(const char *name, size_t length,
+                                           std::uint32_t hash = 2166136261u) {
+    return length == 0 ? hash : ConstHash(
+        name + 1, length - 1,
+        (hash ^ static_cast<unsigned char>(name[0])) * 16777619u);
+  }
+
+  /// Returns the hash of a null terminated name.
+  static std::uint32_t Hash(const char *name) {
+    return Hash(name, std::strlen(name));
+  }
+
+  /// Returns true if the context supports the program interface query (GL 4.3
+  /// or ARB_program_interface_query). It's queried only once.
+  /** The entry points of the query might be declared even if the context
+    * doesn't support them (like with GLEW on a GL 4.1 context), so this is
+    * checked at runtime. */
+  static bool IsInterfaceQuerySupported() {
+    static bool supported = QueryInterfaceQuerySupport();
+    return supported;
+  }
+
+  /// Enumerates the active resources of a linked program.
+  void reflect(GLuint program) {
+    for (auto& resources : resources_) {
+      resources.clear();
+    }
+
+  #if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetProgramInterfaceiv) && \
+      defined(glGetProgramResourceiv) && defined(glGetProgramResourceName))
+    if (IsInterfaceQuerySupported()) {
+      reflectInterface(program, GL_UNIFORM, kUniform);
+      reflectInterface(program, GL_PROGRAM_INPUT, kAttribute);
+      reflectInterface(program, GL_UNIFORM_BLOCK, kUniformBlock);
+      reflectInterface(program, GL_SHADER_STORAGE_BLOCK, kStorageBlock);
+    } else {
+      reflectActiveResources(program);
+    }
+  #else
+    reflectActiveResources(program);
+  #endif
+
+    for (auto& resources : resources_) {
+      std::sort(resources.begin(), resources.end(),
+                [](const Resource& a, const Resource& b) {
+                  return a.hash < b.hash;
+                });
+    }
+  }
+
+  /// Returns true if the program wasn't reflected yet (or has no resources).
+  bool empty() const {
+    for (const auto& resources : resources_) {
+      if (!resources.empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Returns the active resources of a kind, sorted by the hash of their names.
+  const std::vector<Resource>& resources(Interface kind) const {
+    return resources_[kind];
+  }
+
+  /// Finds a resource by its name (and its hash), returns nullptr if it isn't
+  /// active.
+  const Resource* find(Interface kind, const char *name, size_t length,
+                       std::uint32_t hash) const {
+    const std::vector<Resource>& resources = resources_[kind];
+    auto iter = std::lower_bound(
+        resources.begin(), resources.end(), hash,
+        [](const Resource& resource, std::uint32_t hash) {
+          return resource.hash < hash;
+        });
+    for (; iter != resources.end() && iter->hash == hash; ++iter) {
+      if (iter->name.size() == length &&
+          std::memcmp(iter->name.data(), name, length) == 0) {
+        return &*iter;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Finds a resource by its name, returns nullptr if it isn't active.
+  const Resource* find(Interface kind, const char *name) const {
+    size_t length = std::strlen(name);
+    return find(kind, name, length, Hash(name, length));
+  }
+
+  /// Returns the location of a uniform or attribute (kInvalidLocation if it
+  /// isn't active). The name can refer to an array element, like "lights[2]".
+  GLint location(Interface kind, const char *name) const {
+    size_t length = std::strlen(name);
+    const Resource* resource =
+      find(kind, name, length, Hash(name, length));
+    if (resource) {
+      return resource->location;
+    }
+
+    // Try it as an element of an array.
+    if (length > 3 && name[length - 1] == ']') {
+      const char* bracket = name + length - 2;
+      while (bracket > name && *bracket != '[') {
+        --bracket;
+      }
+      size_t base_length = bracket - name;
+      char *end;
+      long index = std::strtol(bracket + 1, &end, 10);
+      if (base_length > 0 && end == name + length - 1 && index >= 0) {
+        return location(kind, name, base_length, index);
+      }
+    }
+
+    return kInvalidLocation;
+  }
+
+  /// Returns the location of an element of an array uniform or attribute
+  /// (kInvalidLocation if it isn't active).
+  GLint location(Interface kind, const char *name, size_t length,
+                 long index) const {
+    const Resource* resource = find(kind, name, length,
+                                    Hash(name, length));
+    if (resource && resource->location != kInvalidLocation &&
+        index < resource->size) {
+      return resource->location + GLint(index);
+    }
+    return kInvalidLocation;
+  }
+
+  /// Returns the location of a uniform (kInvalidLocation if it isn't active).
+  GLint uniformLocation(const char *name) const {
+    return location(kUniform, name);
+  }
+
+  /// Returns the location of an attribute (kInvalidLocation if it isn't
+  /// active).
+  GLint attribLocation(const char *name) const {
+    return location(kAttribute, name);
+  }
+
+  /// Returns the index of a uniform block (kInvalidLocation if it isn't
+  /// active).
+  GLint uniformBlockIndex(const char *name) const {
+    const Resource* resource = find(kUniformBlock, name);
+    return resource ? resource->location : kInvalidLocation;
+  }
+
+  /// Returns the index of a shader storage block (kInvalidLocation if it isn't
+  /// active).
+  GLint storageBlockIndex(const char *name) const {
+    const Resource* resource = find(kStorageBlock, name);
+    return resource ? resource->location : kInvalidLocation;
+  }
+
+ private:
+  std::vector<Resource> resources_[kInterfaceCount];
+
+  /// Adds a resource, reported with the name the GL uses.
+  void add(Interface kind, const char *name, GLint location,
+           GLenum type, GLint size) {
+    std::string stored_name{name};
+    // Array variables are reported as "name[0]", store them by the base name
+    // (but the arrays of blocks are reported element by element).
+    size_t length = stored_name.size();
+    if ((kind == kUniform || kind == kAttribute) && length > 3 &&
+        stored_name.compare(length - 3, 3, "[0]") == 0) {
+      stored_name.erase(length - 3);
+    }
+    std::uint32_t hash = Hash(stored_name.data(), stored_name.size());
+    resources_[kind].push_back(
+        Resource{std::move(stored_name), hash, location, type, size});
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetProgramInterfaceiv) && \
+    defined(glGetProgramResourceiv) && defined(glGetProgramResourceName))
+  /// Enumerates the resources using the program interface query.
+  void reflectInterface(GLuint program, GLenum program_interface,
+                        Interface kind) {
+    GLint count = 0, max_name_length = 0;
+    gl(GetProgramInterfaceiv(program, program_interface,
+                             GL_ACTIVE_RESOURCES, &count));
+    gl(GetProgramInterfaceiv(program, program_interface,
+                             GL_MAX_NAME_LENGTH, &max_name_length));
+    std::vector<GLchar> name(max_name_length + 1);
+
+    bool is_block = program_interface == GL_UNIFORM_BLOCK ||
+                    program_interface == GL_SHADER_STORAGE_BLOCK;
+    for (GLint i = 0; i < count; ++i) {
+      gl(GetProgramResourceName(program, program_interface, i,
+                                GLsizei(name.size()), nullptr, name.data()));
+      if (is_block) {
+        const GLenum props[] = {GL_BUFFER_DATA_SIZE};
+        GLint data_size = 0;
+        gl(GetProgramResourceiv(program, program_interface, i, 1, props,
+                                1, nullptr, &data_size));
+        add(kind, name.data(), i, 0, data_size);
+      } else {
+        const GLenum props[] = {GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION};
+        GLint values[3] = {0, 0, kInvalidLocation};
+        gl(GetProgramResourceiv(program, program_interface, i, 3, props,
+                                3, nullptr, values));
+        // Skip the block members and the built-in variables.
+        if (values[2] != kInvalidLocation) {
+          add(kind, name.data(), values[2], GLenum(values[0]), values[1]);
+        }
+      }
+    }
+  }
+#endif
+
+  static bool QueryInterfaceQuerySupport() {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetStringi)
+    GLint major = 0, minor = 0;
+    gl(GetIntegerv(GL_MAJOR_VERSION, &major));
+    gl(GetIntegerv(GL_MINOR_VERSION, &minor));
+    if (major > 4 || (major == 4 && minor >= 3)) {
+      return true;
+    }
+
+    GLint count = 0;
+    gl(GetIntegerv(GL_NUM_EXTENSIONS, &count));
+    for (GLint i = 0; i < count; ++i) {
+      const GLubyte *name = gl(GetStringi(GL_EXTENSIONS, GLuint(i)));
+      const char *str = reinterpret_cast<const char*>(name);
+      if (str && std::strcmp(str, "GL_ARB_program_interface_query") == 0) {
+        return true;
+      }
+    }
+    return false;
+  #else
+    return IsExtensionSupported("GL_ARB_program_interface_query");
+  #endif
+  }
+
+  /// Enumerates the resources without the program interface query.
+  void reflectActiveResources(GLuint program) {
+    reflectActiveUniforms(program);
+    reflectActiveAttributes(program);
+    reflectActiveUniformBlocks(program);
+  }
+
+  /// Enumerates the uniforms without the program interface query.
+  void reflectActiveUniforms(GLuint program) {
+  #if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetActiveUniform) && \
+      defined(glGetUniformLocation))
+    GLint count = 0, max_name_length = 0;
+    gl(GetProgramiv(program, GL_ACTIVE_UNIFORMS, &count));
+    gl(GetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length));
+    std::vector<GLchar> name(max_name_length + 1);
+
+    for (GLint i = 0; i < count; ++i) {
+      GLint size;
+      GLenum type;
+      gl(GetActiveUniform(program, i, GLsizei(name.size()), nullptr,
+                          &size, &type, name.data()));
+      GLint location = gl(GetUniformLocation(program, name.data()));
+      if (location != kInvalidLocation) {
+        add(kUniform, name.data(), location, type, size);
+      }
+    }
+  #endif
+  }
+
+  /// Enumerates the attributes without the program interface query.
+  void reflectActiveAttributes(GLuint program) {
+  #if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetActiveAttrib) && \
+      defined(glGetAttribLocation))
+    GLint count = 0, max_name_length = 0;
+    gl(GetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count));
+    gl(GetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH,
+                    &max_name_length));
+    std::vector<GLchar> name(max_name_length + 1);
+
+    for (GLint i = 0; i < count; ++i) {
+      GLint size;
+      GLenum type;
+      gl(GetActiveAttrib(program, i, GLsizei(name.size()), nullptr,
+                         &size, &type, name.data()));
+      GLint location = gl(GetAttribLocation(program, name.data()));
+      if (location != kInvalidLocation) {
+        add(kAttribute, name.data(), location, type, size);
+      }
+    }
+  #endif
+  }
+
+  /// Enumerates the uniform blocks without the program interface query.
+  void reflectActiveUniformBlocks(GLuint program) {
+  #if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetActiveUniformBlockiv) && \
+      defined(glGetActiveUniformBlockName))
+    GLint count = 0, max_name_length = 0;
+    gl(GetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &count));
+    gl(GetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH,
+                    &max_name_length));
+    std::vector<GLchar> name(max_name_length + 1);
+
+    for (GLint i = 0; i < count; ++i) {
+      GLint data_size;
+      gl(GetActiveUniformBlockName(program, i, GLsizei(name.size()), nullptr,
+                                   name.data()));
+      gl(GetActiveUniformBlockiv(program, i, GL_UNIFORM_BLOCK_DATA_SIZE,
+                                 &data_size));
+      add(kUniformBlock, name.data(), i, 0, data_size);
+    }
+  #endif
+  }
+};
+
+/// The name of a uniform, with its length and hash computed at compile time.
+/** It's implicitly created from string literals, and it only stores a pointer
+  * to the literal, so it doesn't allocate. Declaring it constexpr guarantees
+  * that the hash isn't computed at runtime:
+  * @code
+  *   constexpr gl::UniformName kColor{"color"};
+  * @endcode */
+struct UniformName {
+  /// The name (a string literal).
+  const char *str;
+  /// The length of the name.
+  size_t length;
+  /// The hash of the name (see ProgramReflection::Hash).
+  std::uint32_t hash;
+
+  template<size_t N>
+  constexpr UniformName(const char (&name)[N])
+      : str(name), length(N - 1)
+      , hash(ProgramReflection::ConstHash(name, N - 1)) { }
+};
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_PROGRAM_REFLECTION_H_
@@ -0,0 +1,169 @@
+// Copyright (c) Tamas Csala
+
+/** @file ring_buffer.h
+    @brief Implements a persistently mapped, fence guarded streaming buffer.
+*/
+
+#ifndef OGLWRAP_RING_BUFFER_H_
+#define OGLWRAP_RING_BUFFER_H_
+
+#include <memory>
+#include <vector>
+#include <stdexcept>
+
+#include "./config.h"
+#include "./buffer.h"
+#include "context/binding.h"
+#include "context/synchronization.h"
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glBufferStorage) \
+    && defined(glMapBufferRange) && defined(glUnmapBuffer) \
+    && defined(glFenceSync) && defined(glClientWaitSync))
+template<BufferType BUFFER_TYPE>
+/// A buffer for streaming data to the GPU every frame without implicit syncs.
+/** The RingBuffer allocates an immutable data store once, that is split into
+  * region_count regions of region_size bytes. The whole store is mapped
+  * persistently and coherently for the lifetime of the object, and every frame
+  * writes only into its own region. Finishing a frame inserts a fence after the
+  * commands that read that region, and a region is only handed out again after
+  * its fence got signaled, so the driver never has to stall on a buffer that is
+  * still in flight.
+  * @see glBufferStorage, glMapBufferRange, glFenceSync, glClientWaitSync */
+class RingBuffer {
+ public:
+  /// A sub-range of the RingBuffer, that was handed out for the current frame.
+  struct Range {
+    /// The client address of the range (already mapped, writeable).
+    void *data;
+    /// The offset of the range in the buffer object in bytes.
+    GLintptr offset;
+    /// The size of the range in bytes.
+    GLsizeiptr size;
+
+    /// Returns the data pointer as a pointer to T.
+    template <typename T>
+    T* as() const { return static_cast<T*>(data); }
+  };
+
+  /// Creates the buffer's storage and maps it persistently.
+  /** @param region_size   The number of bytes that can be written every frame.
+    * @param region_count  The number of frames that can be in flight at the
+    *                      same time. */
+  explicit RingBuffer(GLsizeiptr region_size, unsigned region_count = 3)
+      : region_size_(region_size)
+      , region_count_(region_count)
+      , fences_(region_count) {
+    Bitfield<BufferMapAccessFlags> flags = {
+      BufferMapAccessFlags::kMapWriteBit,
+      BufferMapAccessFlags::kMapPersistentBit,
+      BufferMapAccessFlags::kMapCoherentBit
+    };
+  #if OGLWRAP_USE_DSA
+    buffer_.storage(region_size_ * region_count_, nullptr, flags);
+    map_.reset(new Map(buffer_, 0, region_size_ * region_count_, flags));
+  #else
+    TemporaryBind<BufferObject<BUFFER_TYPE>> bind{buffer_};
+    buffer_.storage(region_size_ * region_count_, nullptr, flags);
+    map_.reset(new Map(0, region_size_ * region_count_, flags));
+  #endif
+  }
+
+  /// Unmaps the buffer.
+  ~RingBuffer() {
+  #if !OGLWRAP_USE_DSA
+    if (map_) {
+      TemporaryBind<BufferObject<BUFFER_TYPE>> bind{buffer_};
+      map_.reset();
+    }
+  #endif
+  }
+
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+
+  /// Hands out a sub-range from the current frame's region.
+  /** @param size       The size of the range in bytes.
+    * @param alignment  The required alignment of the range's offset in the
+    *                   buffer (like GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT).
+    * @return The client pointer and the buffer offset of the range. */
+  Range allocate(GLsizeiptr size, GLsizeiptr alignment = 1) {
+    GLintptr region_start = current_region_ * region_size_;
+    GLintptr offset = region_start + head_;
+    offset = (offset + alignment - 1) / alignment * alignment;
+    if (offset + size > region_start + region_size_) {
+      throw std::length_error{
+        "RingBuffer::allocate called with more data than what fits into the "
+        "current frame's region."};
+    }
+    head_ = offset + size - region_start;
+
+    return Range{map_->data() + offset, offset, size};
+  }
+
+  /// Finishes the current frame, and waits until the next region is free.
+  /** It has to be called after the draw calls that source the current frame's
+    * data were issued.
+    * @see glFenceSync, glClientWaitSync */
+  void nextFrame() {
+    fences_[current_region_].reset(new FenceSync{});
+    current_region_ = (current_region_ + 1) % region_count_;
+    head_ = 0;
+
+    std::unique_ptr<FenceSync>& fence = fences_[current_region_];
+    if (fence) {
+      fence->clientWait();
+      fence.reset();
+    }
+  }
+
+  /// Returns the offset of the current frame's region in bytes.
+  GLintptr regionOffset() const { return current_region_ * region_size_; }
+
+  /// Returns the size of a region in bytes.
+  GLsizeiptr regionSize() const { return region_size_; }
+
+  /// Returns the number of bytes that are already handed out this frame.
+  GLsizeiptr used() const { return head_; }
+
+  /// Returns the underlying buffer object.
+  const BufferObject<BUFFER_TYPE>& buffer() const { return buffer_; }
+
+  /// Returns the handle for the buffer.
+  const glObject& expose() const { return buffer_.expose(); }
+
+ private:
+  using Map = typename BufferObject<BUFFER_TYPE>::template TypedMap<GLubyte>;
+
+  BufferObject<BUFFER_TYPE> buffer_;
+  std::unique_ptr<Map> map_;
+
+  const GLsizeiptr region_size_;
+  const unsigned region_count_;
+  unsigned current_region_ = 0;
+  GLsizeiptr head_ = 0;
+
+  /// The fences guarding each region (null if the region is free).
+  std::vector<std::unique_ptr<FenceSync>> fences_;
+};
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_ARRAY_BUFFER)
+/// A RingBuffer for streaming vertex attribute data.
+using ArrayRingBuffer = RingBuffer<BufferType::kArrayBuffer>;
+#endif  // GL_ARRAY_BUFFER
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_UNIFORM_BUFFER)
+/// A RingBuffer for streaming uniform block data.
+using UniformRingBuffer = RingBuffer<BufferType::kUniformBuffer>;
+#endif  // GL_UNIFORM_BUFFER
+
+#endif  // glBufferStorage && glMapBufferRange && glUnmapBuffer && glFenceSync
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_RING_BUFFER_H_
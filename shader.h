@@ -7,20 +7,158 @@
 #ifndef OGLWRAP_SHADER_H_
 #define OGLWRAP_SHADER_H_
 
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
 #include "./config.h"
 #include "./globjects.h"
+#include "./hash.h"
+#include "./mapped_file.h"
 #include "./shader_source.h"
+#include "context/extensions.h"
 
 #include "./define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
 
+/// Controls the driver's parallel shader compilation
+/// (KHR_parallel_shader_compile or ARB_parallel_shader_compile).
+/** If it is supported, Shader::ready() and Program::ready() can check whether a
+  * compile or link that was started with Shader::compileAsync() or
+  * Program::linkAsync() finished, without waiting for it. */
+class ParallelShaderCompile {
+ public:
+  /// Returns true if the extension is supported (it's queried only once).
+  static bool IsSupported() {
+    static bool supported = QuerySupport();
+    return supported;
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glMaxShaderCompilerThreadsKHR)
+  /// Sets the number of threads the driver can use to compile shaders.
+  /** @param count - The number of threads (0xFFFFFFFF is the driver's
+    *                default, 0 disables the parallel compilation).
+    * @see glMaxShaderCompilerThreadsKHR */
+  static void MaxThreads(GLuint count) {
+    if (IsSupported()) {
+      gl(MaxShaderCompilerThreadsKHR(count));
+    }
+  }
+#endif
+
+ private:
+  static bool QuerySupport() {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetStringi)
+    GLint count = 0;
+    gl(GetIntegerv(GL_NUM_EXTENSIONS, &count));
+    for (GLint i = 0; i < count; ++i) {
+      const GLubyte *name = gl(GetStringi(GL_EXTENSIONS, GLuint(i)));
+      const char *str = reinterpret_cast<const char*>(name);
+      if (str && (std::strcmp(str, "GL_KHR_parallel_shader_compile") == 0 ||
+                  std::strcmp(str, "GL_ARB_parallel_shader_compile") == 0)) {
+        return true;
+      }
+    }
+    return false;
+  #else
+    return IsExtensionSupported("GL_KHR_parallel_shader_compile") ||
+           IsExtensionSupported("GL_ARB_parallel_shader_compile");
+  #endif
+  }
+};
+
+/// Returns the bit of a shader stage for glUseProgramStages (0 if the stage
+/// isn't known).
+inline GLbitfield OGLWRAP_ShaderStageBit(ShaderType shader_t) {
+  switch (shader_t) {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_VERTEX_SHADER_BIT)
+    case ShaderType::kVertexShader:
+      return GL_VERTEX_SHADER_BIT;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_TESS_CONTROL_SHADER_BIT)
+    case ShaderType::kTessControlShader:
+      return GL_TESS_CONTROL_SHADER_BIT;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_TESS_EVALUATION_SHADER_BIT)
+    case ShaderType::kTessEvaluationShader:
+      return GL_TESS_EVALUATION_SHADER_BIT;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_GEOMETRY_SHADER_BIT)
+    case ShaderType::kGeometryShader:
+      return GL_GEOMETRY_SHADER_BIT;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_FRAGMENT_SHADER_BIT)
+    case ShaderType::kFragmentShader:
+      return GL_FRAGMENT_SHADER_BIT;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_COMPUTE_SHADER_BIT)
+    case ShaderType::kComputeShader:
+      return GL_COMPUTE_SHADER_BIT;
+  #endif
+    default:
+      return 0;
+  }
+}
+
+/// The values of the specialization constants of a SPIR-V shader.
+/** @see Shader::specialize */
+class SpecializationConstants {
+ public:
+  /// Sets a bool constant.
+  SpecializationConstants& set(GLuint id, bool value) {
+    return setBits(id, value ? 1 : 0);
+  }
+
+  /// Sets an int constant.
+  SpecializationConstants& set(GLuint id, GLint value) {
+    return setBits(id, static_cast<GLuint>(value));
+  }
+
+  /// Sets an uint constant.
+  SpecializationConstants& set(GLuint id, GLuint value) {
+    return setBits(id, value);
+  }
+
+  /// Sets a float constant.
+  SpecializationConstants& set(GLuint id, GLfloat value) {
+    GLuint bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return setBits(id, bits);
+  }
+
+  /// Returns the number of constants.
+  GLuint size() const { return GLuint(indices_.size()); }
+
+  /// Returns the ids of the constants.
+  const GLuint* indices() const { return indices_.data(); }
+
+  /// Returns the values of the constants (as 32 bit patterns).
+  const GLuint* values() const { return values_.data(); }
+
+ private:
+  std::vector<GLuint> indices_, values_;
+
+  SpecializationConstants& setBits(GLuint id, GLuint bits) {
+    for (size_t i = 0; i < indices_.size(); ++i) {
+      if (indices_[i] == id) {
+        values_[i] = bits;
+        return *this;
+      }
+    }
+    indices_.push_back(id);
+    values_.push_back(bits);
+    return *this;
+  }
+};
+
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glCreateShader)
 /// A GLSL shader object used to control the drawing process.
 /** @see glCreateShader, glDeleteShader */
 class Shader {
  public:
-  enum State { kNotCompiled, kCompileFailure, kCompileSuccessful };
+  enum State { kNotCompiled, kCompiling, kCompileFailure, kCompileSuccessful };
 
  private:
   globjects::Shader shader_;  // The handle for the buffer.
@@ -29,6 +167,12 @@ class Shader {
   /// Stores the source file's name if the shader was initialized from file.
   std::string filename_;
 
+  /// The hash of the shader's type and source (0 if it's unknown).
+  std::uint64_t source_hash_ = 0;
+
+  /// True if the shader was made from a SPIR-V binary.
+  bool spirv_ = false;
+
  protected:
   mutable State state_ = kNotCompiled;
 
@@ -68,16 +212,32 @@ class Shader {
     * @see glShaderSource */
   void set_source(const std::string& source) {
     const char *str = source.c_str();
+    source_hash_ = HashSource(shader_t_, source);
     gl(ShaderSource(shader_, 1, &str, nullptr));
+    spirv_ = false;
   }
 
   /// Uploads a ShaderSource as the shader's source.
   /** @param source - The source of the shader code.
     * @see glShaderSource */
   void set_source(const ShaderSource& source) {
-    const char *str = source.source().c_str();
+    // The segments are passed as they are, without concatenating them.
+    std::vector<ShaderSource::Segment> segments = source.segments();
+    std::vector<const GLchar*> strings(segments.size());
+    std::vector<GLint> lengths(segments.size());
+    std::uint64_t hash = OGLWRAP_HashValue(OGLWRAP_HashInit(),
+                                           GLenum(shader_t_));
+    for (size_t i = 0; i < segments.size(); ++i) {
+      strings[i] = segments[i].data;
+      lengths[i] = GLint(segments[i].size);
+      hash = OGLWRAP_HashBytes(hash, segments[i].data, segments[i].size);
+    }
+
     filename_ = source.source_file();
-    gl(ShaderSource(shader_, 1, &str, nullptr));
+    source_hash_ = hash == 0 ? 1 : hash;
+    gl(ShaderSource(shader_, GLsizei(segments.size()), strings.data(),
+                    lengths.data()));
+    spirv_ = false;
   }
 
   /// Returns the file's name that was loaded in.
@@ -95,18 +255,131 @@ class Shader {
     return shader_t_;
   }
 
+  /// Returns the hash of the shader's type and source code (after the macro
+  /// insertions), or 0 if the source wasn't set through oglwrap.
+  std::uint64_t source_hash() const {
+    return source_hash_;
+  }
+
+  /// Returns a hash (64 bit FNV-1a) of a shader source.
+  static std::uint64_t HashSource(ShaderType shader_t,
+                                  const std::string& source) {
+    return HashSource(shader_t, source.data(), source.size());
+  }
+
+  /// Returns a hash (64 bit FNV-1a) of a shader source or binary.
+  static std::uint64_t HashSource(ShaderType shader_t, const void *source,
+                                  size_t size) {
+    std::uint64_t hash = OGLWRAP_HashValue(OGLWRAP_HashInit(),
+                                           GLenum(shader_t));
+    hash = OGLWRAP_HashBytes(hash, source, size);
+    return hash == 0 ? 1 : hash;
+  }
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glShaderBinary) && \
+    defined(GL_SHADER_BINARY_FORMAT_SPIR_V))
+  /// Uploads a SPIR-V module as the shader's binary.
+  /** The shader has to be specialized (instead of compiled) afterwards, which
+    * is done by compile() with the default values and the "main" entry point,
+    * or by specialize().
+    * @param binary - The SPIR-V module.
+    * @param length - The size of the module in bytes.
+    * @see glShaderBinary */
+  void set_spirv(const void *binary, GLsizei length) {
+    GLuint shader = shader_;
+    gl(ShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binary,
+                    length));
+    source_hash_ = HashSource(shader_t_, binary, size_t(length));
+    spirv_ = true;
+    state_ = kNotCompiled;
+  }
+
+  /// Loads a precompiled SPIR-V module from a file as the shader's binary.
+  /** The file is memory mapped, so it's only copied once, by the driver.
+    * @param file - The path to the file (relative to
+    *               OGLWRAP_DEFAULT_SHADER_PATH).
+    * @see glShaderBinary */
+  void set_spirv(const std::string& file) {
+    MappedFile module{OGLWRAP_DEFAULT_SHADER_PATH + file};
+    filename_ = file;
+    set_spirv(module.data(), GLsizei(module.size()));
+  }
+#endif  // glShaderBinary && GL_SHADER_BINARY_FORMAT_SPIR_V
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glSpecializeShader)
+  /// Specializes a SPIR-V shader (this replaces compiling it).
+  /** One module can be specialized into many shaders with different
+    * constants. The result is checked like a compilation's, by compile()
+    * (or when the shader is attached to a program), or by ready().
+    * @param constants - The values of the specialization constants, the
+    *                    others keep their default values.
+    * @param entry_point - The name of the entry point function.
+    * @see glSpecializeShader */
+  void specialize(const SpecializationConstants& constants =
+                      SpecializationConstants{},
+                  const char *entry_point = "main") {
+    if (!spirv_ || state_ != kNotCompiled) {
+      throw std::logic_error{"Shader::specialize called on a shader that "
+          "isn't an unspecialized SPIR-V module ('" + filename_ + "')."};
+    }
+    gl(SpecializeShader(shader_, entry_point, constants.size(),
+                        constants.indices(), constants.values()));
+    source_hash_ = OGLWRAP_HashBytes(source_hash_, entry_point,
+                                     strlen(entry_point));
+    source_hash_ = OGLWRAP_HashBytes(source_hash_, constants.indices(),
+                                     constants.size() * sizeof(GLuint));
+    source_hash_ = OGLWRAP_HashBytes(source_hash_, constants.values(),
+                                     constants.size() * sizeof(GLuint));
+    source_hash_ = source_hash_ == 0 ? 1 : source_hash_;
+    state_ = kCompiling;
+  }
+#endif  // glSpecializeShader
+
+  /// Returns true if the shader was made from a SPIR-V module.
+  bool is_spirv() const { return spirv_; }
+
 #if OGLWRAP_DEFINE_EVERYTHING || ( \
   defined(glCompileShader) && \
   defined(glGetShaderiv) && \
   defined(glGetShaderInfoLog) \
 )
-  /// Compiles the shader code.
+  /// Starts compiling the shader code, without waiting for the result.
+  /** The compilation is finished by compile() (that is called when the shader
+    * is attached to a program), or by ready() once it returns true.
+    * @see glCompileShader */
+  void compileAsync() const {
+    if (state_ == kNotCompiled) {
+      startCompile();
+      state_ = kCompiling;
+    }
+  }
+
+  /// Returns true if compile() wouldn't have to wait for the compiler.
+  /** It can only tell that without waiting if the ParallelShaderCompile
+    * extension is supported, otherwise it always returns true.
+    * @see GL_COMPLETION_STATUS_KHR */
+  bool ready() const {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_COMPLETION_STATUS_KHR)
+    if (state_ == kCompiling && ParallelShaderCompile::IsSupported()) {
+      GLint completed = GL_TRUE;
+      gl(GetShaderiv(shader_, GL_COMPLETION_STATUS_KHR, &completed));
+      if (completed == GL_FALSE) {
+        return false;
+      }
+    }
+  #endif
+    compile();
+    return true;
+  }
+
+  /// Compiles the shader code (or waits for a compileAsync() to finish).
   /** @see glCompileShader, glGetShaderiv, glGetShaderInfoLog */
   void compile() const {
-    if (state_ != kNotCompiled) {
+    if (state_ == kNotCompiled) {
+      startCompile();
+    } else if (state_ != kCompiling) {
       return;
     }
-    gl(CompileShader(shader_));
 
     // Get compilation status
     GLint status;
@@ -156,6 +429,20 @@ class Shader {
   const glObject& expose() const  {
     return shader_;
   }
+
+ private:
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glCompileShader)
+  /// Compiles a GLSL shader, or specializes a SPIR-V one with the defaults.
+  void startCompile() const {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(glSpecializeShader)
+    if (spirv_) {
+      gl(SpecializeShader(shader_, "main", 0, nullptr, nullptr));
+      return;
+    }
+  #endif
+    gl(CompileShader(shader_));
+  }
+#endif  // glCompileShader
 };
 
 
@@ -7,23 +7,136 @@
 #ifndef OGLWRAP_SHADER_SOURCE_H_
 #define OGLWRAP_SHADER_SOURCE_H_
 
+#include <ctime>
+#include <memory>
 #include <string>
-#include <fstream>
+#include <vector>
+#include <cstring>
 #include <sstream>
+#include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
+#include <sys/stat.h>
 
 #include "./config.h"
+#include "./mapped_file.h"
 
 #include "./define_internal_macros.h"
 
 namespace OGLWRAP_NAMESPACE_NAME {
 
+/// An in-memory cache of the shader files' contents.
+/** The files are memory mapped (see MappedFile), and a file is only mapped
+  * again if its modification time or size changed, so the files that are
+  * included by many shaders are only read once. */
+class ShaderFileCache {
+ public:
+  /// Returns the contents of a file, and maps it if it isn't cached yet.
+  /** Throws std::runtime_error if the file doesn't exist. */
+  static std::shared_ptr<const MappedFile> Load(const std::string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+      throw std::runtime_error("Shader file '" + path + "' not found.");
+    }
+
+    Entry& entry = GetInstanceSingleton().entries_[path];
+    if (!entry.contents || entry.mtime != info.st_mtime ||
+        entry.size != static_cast<long long>(info.st_size)) {
+      std::shared_ptr<const MappedFile> contents =
+          std::make_shared<MappedFile>(path);
+
+      entry.contents = contents;
+      entry.mtime = info.st_mtime;
+      entry.size = static_cast<long long>(info.st_size);
+      ++GetInstanceSingleton().reads_;
+    }
+    return entry.contents;
+  }
+
+  /// Returns true if the file exists.
+  static bool Exists(const std::string& path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+  }
+
+  /// Returns the number of times a file had to be (re)mapped.
+  static size_t Reads() {
+    return GetInstanceSingleton().reads_;
+  }
+
+  /// Drops the cached contents of a file, so it's read again next time (even
+  /// if it was modified within the resolution of its modification time).
+  static void Forget(const std::string& path) {
+    GetInstanceSingleton().entries_.erase(path);
+  }
+
+  /// Drops the cached contents of every file.
+  static void Clear() {
+    GetInstanceSingleton().entries_.clear();
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<const MappedFile> contents;
+    std::time_t mtime = 0;
+    long long size = 0;
+  };
+
+  std::unordered_map<std::string, Entry> entries_;
+  size_t reads_ = 0;
+
+  static ShaderFileCache& GetInstanceSingleton() {
+    static ShaderFileCache instance;
+    return instance;
+  }
+};
+
 /**
  * @brief A class that can load shader sources in from files, and do some
  *        preprocessing on them.
+ *
+ * The files loaded with loadFromFile can use #include "file" directives, the
+ * paths are relative to the including file (or to OGLWRAP_DEFAULT_SHADER_PATH).
+ * The included files can be guarded with #pragma once, or with the usual
+ * #ifndef include guards. The included contents are marked with #line
+ * directives, with the index of the file in included_files() as the source
+ * string number, so the compile errors can be mapped back to the files.
+ *
+ * A loaded source isn't copied into a single string: it's a list of segments
+ * that point into the mapped files (and the few generated lines), and these
+ * are passed to glShaderSource as they are. The source is only concatenated
+ * if source() is called. The mapped files can be rewritten in place by an
+ * editor, so a loaded source should be uploaded right away. A source that is
+ * kept for later has to be copied: the copies own their text.
  */
 class ShaderSource {
-  std::string src_, filename_;
+ public:
+  /// A part of the source (not null terminated).
+  struct Segment {
+    const char *data;
+    size_t size;
+  };
+
+ private:
+  std::string filename_;
+
+  /// The source, if it was set as a string, or concatenated by source().
+  mutable std::string src_;
+
+  /// The parts of the source, if it is loaded from files (empty otherwise).
+  std::vector<Segment> segments_;
+
+  /// True if src_ is a concatenation of segments_.
+  mutable bool src_is_cached_ = false;
+
+  /// Keeps the memory that the segments point into alive.
+  std::vector<std::shared_ptr<const void>> storage_;
+
+  /// The paths of the loaded files, in the order of their source numbers.
+  std::vector<std::string> files_;
+
+  /// True if some of the segments point into mapped files.
+  bool maps_files_ = false;
 
  public:
   /// Default constructor.
@@ -35,37 +148,123 @@ class ShaderSource {
     loadFromFile(file);
   }
 
-  /// Returns the source.
-  std::string const& source() const { return src_; }
+  /// Copies a source. The parts that point into mapped files are copied, so
+  /// the copy stays valid even if the files are changed later.
+  ShaderSource(const ShaderSource& other)
+      : filename_(other.filename_), src_(other.src_)
+      , segments_(other.segments_), src_is_cached_(other.src_is_cached_)
+      , storage_(other.storage_), files_(other.files_)
+      , maps_files_(other.maps_files_) {
+    if (maps_files_) {
+      snapshot();
+    }
+  }
+
+  /// Moves a source (without copying its text).
+  ShaderSource(ShaderSource&&) = default;
+
+  /// Copies a source. The parts that point into mapped files are copied.
+  ShaderSource& operator=(const ShaderSource& other) {
+    ShaderSource copy{other};
+    return *this = std::move(copy);
+  }
+
+  /// Moves a source (without copying its text).
+  ShaderSource& operator=(ShaderSource&&) = default;
 
-  /// Returns the source.
-  std::string& source() { return src_; }
+  /// Returns the source (concatenates the segments, if it has any).
+  std::string const& source() const {
+    if (!segments_.empty() && !src_is_cached_) {
+      src_.clear();
+      for (const Segment& segment : segments_) {
+        src_.append(segment.data, segment.size);
+      }
+      src_is_cached_ = true;
+    }
+    return src_;
+  }
+
+  /// Returns the source as a modifiable string.
+  std::string& source() {
+    set_source(static_cast<const ShaderSource*>(this)->source());
+    return src_;
+  }
+
+  /// Returns the parts of the source, that can be passed to glShaderSource.
+  std::vector<Segment> segments() const {
+    if (segments_.empty()) {
+      return std::vector<Segment>{Segment{src_.data(), src_.size()}};
+    }
+    return segments_;
+  }
 
   /// Adds a string as the shader source.
   /** @param source_string - The source string. */
   void set_source(const std::string& source_string) {
     src_ = source_string;
+    segments_.clear();
+    storage_.clear();
+    src_is_cached_ = false;
+    maps_files_ = false;
   }
 
-  /// Loads in the shader from a file.
+  /// Loads in the shader from a file, and resolves its #include directives.
   /** @param file - The path to the file. */
   void loadFromFile(const std::string& file) {
     filename_ = file;
-    std::ifstream shader_file((OGLWRAP_DEFAULT_SHADER_PATH + file).c_str());
-    if (!shader_file.is_open()) {
-      throw std::runtime_error("Shader file '" +
-          (OGLWRAP_DEFAULT_SHADER_PATH + file) + "' not found.");
+    set_source(std::string{});
+    files_.clear();
+    // The path is spelled the same way as the included files' paths.
+    appendFile(NormalizePath(OGLWRAP_DEFAULT_SHADER_PATH + file), 0);
+  }
+
+  /// Inserts lines (like #defines) after the #version line, followed by a
+  /// #line directive, so the line numbers of the compile errors don't change.
+  /** The text is added as a new segment, the rest of the source isn't copied.
+    * @param prelude - The lines to insert, ending with a new line. */
+  void insertPrelude(const std::string& prelude) {
+    if (segments_.empty()) {
+      std::shared_ptr<const std::string> text =
+          std::make_shared<std::string>(std::move(src_));
+      set_source(std::string{});
+      addSegment(text->data(), text->size(), text);
     }
-    std::stringstream shader_string;
-    shader_string << shader_file.rdbuf();
+    src_is_cached_ = false;
 
-    // Remove the EOF from the end of the string.
-    src_ = shader_string.str();
-    if (src_[src_.length() - 1] == EOF) {
-      src_.pop_back();
+    unsigned line = 1;
+    for (size_t i = 0; i < segments_.size(); ++i) {
+      const Segment segment = segments_[i];
+      const char *end = segment.data + segment.size;
+      const char *version = Find(segment, "#version");
+      if (version == end) {
+        line += unsigned(std::count(segment.data, end, '\n'));
+        continue;
+      }
+
+      line += unsigned(std::count(segment.data, version, '\n')) + 1;
+      const char *line_end = std::find(version, end, '\n');
+      std::string text = prelude + "#line " + std::to_string(line) + '\n';
+      if (line_end == end) {
+        text = '\n' + text;
+      } else {
+        ++line_end;
+      }
+      splitSegment(i, line_end - segment.data, line_end - segment.data,
+                   std::move(text));
+      return;
     }
+
+    std::string text = prelude + "#line 1\n";
+    std::shared_ptr<const std::string> owned =
+        std::make_shared<std::string>(std::move(text));
+    segments_.insert(segments_.begin(), Segment{owned->data(), owned->size()});
+    storage_.push_back(owned);
   }
 
+  /// Returns the paths of the files the source was loaded from. The index of
+  /// a file is its source string number in the compile errors.
+  const std::vector<std::string>& included_files() const { return files_; }
+
   /// Returns the file's name that was loaded in.
   const std::string& source_file() const { return filename_; }
 
@@ -78,7 +277,26 @@ class ShaderSource {
   /** @param macro_name - The name of the macro.
     * @param value - The value to insert. */
   void insertMacroValue(const std::string& macro_name, const T& value) {
-    size_t macro_pos = src_.find("#define " + macro_name);
+    std::string define = "#define " + macro_name;
+    std::ostringstream sstream;
+    sstream << ' ' << value;
+
+    // The value is inserted as a new segment, the source isn't copied.
+    for (size_t i = 0; i < segments_.size(); ++i) {
+      const Segment segment = segments_[i];
+      const char *end = segment.data + segment.size;
+      const char *macro = Find(segment, define.c_str());
+      if (macro != end) {
+        const char *value_pos = macro + define.size();
+        const char *macro_end = std::find(value_pos, end, '\n');
+        src_is_cached_ = false;
+        splitSegment(i, value_pos - segment.data, macro_end - segment.data,
+                     sstream.str());
+        return;
+      }
+    }
+
+    size_t macro_pos = segments_.empty() ? src_.find(define) : std::string::npos;
   #if OGLWRAP_DEBUG
     if (macro_pos == std::string::npos) {
       throw std::invalid_argument(
@@ -86,13 +304,245 @@ class ShaderSource {
         "', but the shader doesn't have any macro named " + macro_name);
     }
   #endif
+    if (macro_pos == std::string::npos) {
+      return;
+    }
 
+    size_t value_pos = macro_pos + define.length();
     size_t macro_end = src_.find('\n', macro_pos);
 
-    std::stringstream sstream;
-    sstream << src_.substr(0, macro_pos+strlen("#define ")+macro_name.length());
-    sstream << ' ' << value << src_.substr(macro_end);
-    src_ = sstream.str();
+    // Only the macro's value is replaced, the rest of the source isn't copied.
+    src_.replace(value_pos, macro_end - value_pos, sstream.str());
+  }
+
+ private:
+  /// The maximal nesting depth of the includes (to stop recursive includes).
+  enum : unsigned { kMaxIncludeDepth = 32 };
+
+  /// Appends a file to the source, and the files it includes, recursively.
+  void appendFile(const std::string& path, unsigned depth) {
+    if (depth > kMaxIncludeDepth) {
+      throw std::runtime_error("Shader file '" + path + "' is included "
+          "recursively (the includes are nested too deeply).");
+    }
+
+    std::shared_ptr<const MappedFile> contents = ShaderFileCache::Load(path);
+    maps_files_ = true;
+    const char *text = contents->data();
+    size_t size = contents->size();
+    std::string argument;
+
+    bool pragma_once = false;
+    for (size_t pos = 0; pos < size; pos = NextLine(text, size, pos)) {
+      if (ParseDirective(text, size, pos, "pragma", &argument) &&
+          argument == "once") {
+        pragma_once = true;
+        break;
+      }
+    }
+    if (pragma_once &&
+        std::find(files_.begin(), files_.end(), path) != files_.end()) {
+      return;
+    }
+
+    size_t file_index = files_.size();
+    files_.push_back(path);
+    if (depth != 0) {
+      addSegment("#line 1 " + std::to_string(file_index) + '\n');
+    }
+
+    // The lines between the directives are added as one segment.
+    size_t run_begin = 0;
+    unsigned line_number = 1;
+    for (size_t pos = 0; pos < size; ++line_number) {
+      size_t next = NextLine(text, size, pos);
+      if (ParseDirective(text, size, pos, "include", &argument)) {
+        if (argument.empty()) {
+          throw std::runtime_error("Invalid #include directive in shader file '"
+              + path + "' at line " + std::to_string(line_number) + ".");
+        }
+        addSegment(text + run_begin, pos - run_begin, contents);
+        appendFile(ResolveInclude(path, argument), depth + 1);
+        addSegment("#line " + std::to_string(line_number + 1) + ' ' +
+                   std::to_string(file_index) + '\n');
+        run_begin = next;
+      } else if (ParseDirective(text, size, pos, "pragma", &argument) &&
+                 argument == "once") {
+        addSegment(text + run_begin, pos - run_begin, contents);
+        addSegment("\n");
+        run_begin = next;
+      }
+      pos = next;
+    }
+    addSegment(text + run_begin, size - run_begin, contents);
+
+    if (depth != 0 && size != 0 && text[size - 1] != '\n') {
+      addSegment("\n");
+    }
+  }
+
+  /// Copies the segments' text into a string owned by the source.
+  void snapshot() {
+    size_t size = 0;
+    for (const Segment& segment : segments_) {
+      size += segment.size;
+    }
+    std::shared_ptr<std::string> text = std::make_shared<std::string>();
+    text->reserve(size);
+    for (const Segment& segment : segments_) {
+      text->append(segment.data, segment.size);
+    }
+
+    const char *data = text->data();
+    for (Segment& segment : segments_) {
+      segment.data = data;
+      data += segment.size;
+    }
+    storage_.assign(1, text);
+    maps_files_ = false;
+  }
+
+  /// Adds a segment that points into memory owned by storage.
+  void addSegment(const char *data, size_t size,
+                  const std::shared_ptr<const void>& storage) {
+    if (size != 0) {
+      segments_.push_back(Segment{data, size});
+      if (storage_.empty() || storage_.back() != storage) {
+        storage_.push_back(storage);
+      }
+    }
+  }
+
+  /// Adds a string literal as a segment.
+  void addSegment(const char *literal) {
+    segments_.push_back(Segment{literal, strlen(literal)});
+  }
+
+  /// Adds a generated string as a segment.
+  void addSegment(std::string text) {
+    std::shared_ptr<const std::string> owned =
+        std::make_shared<std::string>(std::move(text));
+    addSegment(owned->data(), owned->size(), owned);
+  }
+
+  /// Replaces the [begin, end) part of a segment with a new string.
+  void splitSegment(size_t index, size_t begin, size_t end, std::string text) {
+    Segment segment = segments_[index];
+    std::shared_ptr<const std::string> owned =
+        std::make_shared<std::string>(std::move(text));
+    storage_.push_back(owned);
+
+    Segment parts[] = {
+      Segment{segment.data, begin},
+      Segment{owned->data(), owned->size()},
+      Segment{segment.data + end, segment.size - end}
+    };
+    segments_.erase(segments_.begin() + index);
+    for (const Segment& part : parts) {
+      if (part.size != 0) {
+        segments_.insert(segments_.begin() + index++, part);
+      }
+    }
+  }
+
+  /// Returns the first occurrence of str in a segment (or its end).
+  static const char* Find(const Segment& segment, const char *str) {
+    return std::search(segment.data, segment.data + segment.size,
+                       str, str + strlen(str));
+  }
+
+  /// Returns the position of the line after the one starting at pos.
+  static size_t NextLine(const char *text, size_t size, size_t pos) {
+    const char *line_end = std::find(text + pos, text + size, '\n');
+    return line_end == text + size ? size : line_end - text + 1;
+  }
+
+  /// Skips the spaces and tabs from pos (but not after end).
+  static size_t SkipSpaces(const char *text, size_t pos, size_t end) {
+    while (pos < end && (text[pos] == ' ' || text[pos] == '\t')) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  /// Checks if the line at pos is a directive (like "#include"), and returns
+  /// its argument without the quotes or angle brackets.
+  static bool ParseDirective(const char *text, size_t size, size_t pos,
+                             const char *directive, std::string *argument) {
+    size_t line_end = NextLine(text, size, pos);
+    pos = SkipSpaces(text, pos, line_end);
+    if (pos >= line_end || text[pos] != '#') {
+      return false;
+    }
+    pos = SkipSpaces(text, pos + 1, line_end);
+    size_t length = strlen(directive);
+    if (line_end - pos < length || std::memcmp(text + pos, directive, length)) {
+      return false;
+    }
+    pos += length;
+    if (pos < line_end && text[pos] != ' ' && text[pos] != '\t' &&
+        text[pos] != '"' && text[pos] != '<' && text[pos] != '\r' &&
+        text[pos] != '\n') {
+      return false;
+    }
+
+    size_t arg_begin = SkipSpaces(text, pos, line_end);
+    size_t arg_end = line_end;
+    while (arg_end > arg_begin && std::strchr(" \t\r\n", text[arg_end - 1])) {
+      --arg_end;
+    }
+    argument->assign(text + arg_begin, arg_end - arg_begin);
+    if (argument->size() >= 2 &&
+        ((argument->front() == '"' && argument->back() == '"') ||
+         (argument->front() == '<' && argument->back() == '>'))) {
+      *argument = argument->substr(1, argument->size() - 2);
+    }
+    return true;
+  }
+
+  /// Returns the path of an included file: relative to the including file if
+  /// it exists there, and relative to the default shader path otherwise.
+  static std::string ResolveInclude(const std::string& including_file,
+                                    const std::string& name) {
+    size_t slash = including_file.find_last_of("/\\");
+    if (slash != std::string::npos) {
+      std::string path =
+          NormalizePath(including_file.substr(0, slash + 1) + name);
+      if (ShaderFileCache::Exists(path)) {
+        return path;
+      }
+    }
+    return NormalizePath(OGLWRAP_DEFAULT_SHADER_PATH + name);
+  }
+
+  /// Removes the "." and "dir/.." parts of a path, so a file included through
+  /// different relative paths is only cached (and #pragma once-d) once.
+  static std::string NormalizePath(const std::string& path) {
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    while (begin <= path.size()) {
+      size_t end = path.find_first_of("/\\", begin);
+      if (end == std::string::npos) {
+        end = path.size();
+      }
+      std::string part = path.substr(begin, end - begin);
+      if (part == ".." && !parts.empty() && parts.back() != ".." &&
+          !parts.back().empty()) {
+        parts.pop_back();
+      } else if (part != "." && !(part.empty() && !parts.empty())) {
+        parts.push_back(part);
+      }
+      begin = end + 1;
+    }
+
+    std::string result;
+    for (size_t i = 0; i < parts.size(); ++i) {
+      if (i != 0) {
+        result += '/';
+      }
+      result += parts[i];
+    }
+    return result;
   }
 };
 
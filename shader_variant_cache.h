@@ -0,0 +1,172 @@
+// Copyright (c) Tamas Csala
+
+/** @file shader_variant_cache.h
+    @brief Implements a cache for the preprocessor permutations of a shader.
+*/
+
+#ifndef OGLWRAP_SHADER_VARIANT_CACHE_H_
+#define OGLWRAP_SHADER_VARIANT_CACHE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "./config.h"
+#include "./shader.h"
+#include "./shader_source.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// A set of preprocessor macros, that select a variant of a shader.
+/** The macros are kept sorted by their names, so the order in which they are
+  * set doesn't matter, the same set always selects the same variant. */
+class ShaderDefines {
+ public:
+  /// Defines a macro without a value (like #define USE_SHADOWS).
+  ShaderDefines& set(const std::string& name) {
+    defines_[name] = std::string{};
+    return *this;
+  }
+
+  template<typename T>
+  /// Defines a macro with a value (like #define LIGHT_COUNT 4).
+  ShaderDefines& set(const std::string& name, const T& value) {
+    std::ostringstream sstream;
+    sstream << value;
+    defines_[name] = sstream.str();
+    return *this;
+  }
+
+  /// Removes a macro from the set.
+  ShaderDefines& unset(const std::string& name) {
+    defines_.erase(name);
+    return *this;
+  }
+
+  /// Returns the #define lines of the macros.
+  std::string prelude() const {
+    std::string str;
+    for (const auto& define : defines_) {
+      str += "#define " + define.first;
+      if (!define.second.empty()) {
+        str += ' ' + define.second;
+      }
+      str += '\n';
+    }
+    return str;
+  }
+
+  /// Returns a short description of the macros, like "A=1 B".
+  std::string description() const {
+    std::string str;
+    for (const auto& define : defines_) {
+      if (!str.empty()) {
+        str += ' ';
+      }
+      str += define.first;
+      if (!define.second.empty()) {
+        str += '=' + define.second;
+      }
+    }
+    return str;
+  }
+
+  /// Returns the number of macros.
+  size_t size() const { return defines_.size(); }
+
+ private:
+  std::map<std::string, std::string> defines_;
+};
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glCreateShader)
+/// Builds, and caches the variants of a shader, that differ only in a set of
+/// preprocessor macros.
+/** A variant is built by inserting the #define lines of a ShaderDefines after
+  * the #version line of the base source (and a #line directive after them, so
+  * the compile errors still refer to the lines of the base source), as an
+  * extra segment passed to glShaderSource, without copying the base (the
+  * cache owns a copy of the base, that doesn't change with the files). The
+  * variants are identified by the hash of their macros, the same set of macros
+  * never creates a second shader, and a variant is only created, and its
+  * compilation started, when it's first requested:
+  * @code
+  *   gl::ShaderVariantCache cache{gl::kFragmentShader, gl::ShaderSource{"uber.frag"}};
+  *   const gl::Shader& fs = cache.get(gl::ShaderDefines{}
+  *                                    .set("USE_SHADOWS").set("LIGHT_COUNT", 4));
+  * @endcode */
+class ShaderVariantCache {
+ public:
+  /// Creates a cache for the variants of a shader source.
+  /** @param shader_t - The type of the shaders.
+    * @param source - The base source, without the variant's macros. */
+  ShaderVariantCache(ShaderType shader_t, const ShaderSource& source)
+      : shader_t_(shader_t), source_(source) { }
+
+  /// Returns the variant with the macros, and creates it if it doesn't exist.
+  /** A new variant's compilation is started with Shader::compileAsync(), it's
+    * finished when the shader is attached to a program. */
+  const Shader& get(const ShaderDefines& defines) {
+    std::string prelude = defines.prelude();
+    std::uint64_t key = Shader::HashSource(shader_t_, prelude);
+    auto iter = variants_.find(key);
+    if (iter != variants_.end()) {
+    #if OGLWRAP_DEBUG
+      if (iter->second.prelude != prelude) {
+        throw std::logic_error{
+          "ShaderVariantCache: hash collision between the variants '" +
+          iter->second.shader->source_file_name() + "' and (" +
+          defines.description() + ")"};
+      }
+    #endif
+      return *iter->second.shader;
+    }
+
+    ShaderSource source = source_;
+    source.insertPrelude(prelude);
+    source.set_source_file(source_.source_file() + " (" +
+                           defines.description() + ")");
+
+    Variant& variant = variants_[key];
+  #if OGLWRAP_DEBUG
+    variant.prelude = prelude;
+  #endif
+    variant.shader.reset(new Shader{shader_t_, source});
+    variant.shader->compileAsync();
+    return *variant.shader;
+  }
+
+  /// Returns the source of a variant, without creating a shader for it.
+  std::string source(const ShaderDefines& defines) const {
+    ShaderSource source = source_;
+    source.insertPrelude(defines.prelude());
+    return source.source();
+  }
+
+  /// Returns the number of variants that were created.
+  size_t size() const { return variants_.size(); }
+
+  /// Deletes all the variants.
+  /** The references returned by get() are invalidated by this. */
+  void clear() { variants_.clear(); }
+
+ private:
+  struct Variant {
+  #if OGLWRAP_DEBUG
+    std::string prelude;
+  #endif
+    std::unique_ptr<Shader> shader;
+  };
+
+  ShaderType shader_t_;
+  ShaderSource source_;
+  std::unordered_map<std::uint64_t, Variant> variants_;
+};
+#endif  // glCreateShader
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_SHADER_VARIANT_CACHE_H_
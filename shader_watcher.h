@@ -0,0 +1,284 @@
+// Copyright (c) Tamas Csala
+
+/** @file shader_watcher.h
+    @brief Implements the hot reloading of shader files (on Linux).
+*/
+
+#ifndef OGLWRAP_SHADER_WATCHER_H_
+#define OGLWRAP_SHADER_WATCHER_H_
+
+#include <set>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <initializer_list>
+
+#include "./config.h"
+#include "./shader.h"
+#include "./program.h"
+#include "./shader_source.h"
+
+#if defined(__linux__)
+  #include <unistd.h>
+  #include <sys/inotify.h>
+#endif
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if defined(__linux__) && (OGLWRAP_DEFINE_EVERYTHING || \
+    (defined(glCreateShader) && defined(glCreateProgram)))
+/// Watches the shader files (and the files they include) with inotify, and
+/// rebuilds the programs that use them when they change.
+/** Only the shaders that depend on a changed file are recompiled, and only the
+  * programs that use a recompiled shader are relinked. A program is replaced
+  * only if all of its shaders compiled and it linked successfully, so an
+  * error in a shader keeps the old program working until it's fixed.
+  * @code
+  *   gl::ShaderWatcher watcher;
+  *   gl::Program prog;
+  *   watcher.link(prog, {{gl::kVertexShader, "a.vert"},
+  *                       {gl::kFragmentShader, "a.frag"}});
+  *   watcher.onReload([](gl::Program& prog) { // re-query the uniforms });
+  *   // Every frame:
+  *   watcher.update();
+  * @endcode
+  * A reloaded program gets a new handle, so it has to be used again, and the
+  * Uniforms and UniformHandles made for it have to be recreated, which can be
+  * done in the onReload callback. The watched programs must not be moved or
+  * destroyed while they are watched (see unwatch()). */
+class ShaderWatcher {
+ public:
+  /// A shader file, and the type of the shader made from it.
+  struct ShaderFile {
+    ShaderType type;
+    std::string path;
+  };
+
+  /// Creates the inotify instance.
+  /** Throws std::runtime_error if inotify isn't available. */
+  ShaderWatcher() : inotify_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {
+    if (inotify_ < 0) {
+      throw std::runtime_error{"ShaderWatcher: inotify_init1 failed."};
+    }
+  }
+
+  ShaderWatcher(const ShaderWatcher&) = delete;
+  ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+  ~ShaderWatcher() {
+    close(inotify_);
+  }
+
+  /// Loads and compiles the shaders, links them into program, and relinks it
+  /// whenever any of the files (or the files they include) change.
+  /** @param program - An empty program object.
+    * @param files - The shader files (the shaders that are used by more
+    *                programs are only compiled once).
+    * @return The program. */
+  Program& link(Program& program, std::initializer_list<ShaderFile> files) {
+    ProgramEntry entry{&program, {}};
+    for (const ShaderFile& file : files) {
+      entry.shaders.push_back(shader(file));
+    }
+    for (ShaderEntry *shader : entry.shaders) {
+      shader->shader->compile();
+      program.attachShader(*shader->shader);
+    }
+    program.link();
+    programs_.push_back(entry);
+    return program;
+  }
+
+  /// Stops watching a program (has to be called before it's destroyed).
+  void unwatch(const Program& program) {
+    programs_.erase(std::remove_if(programs_.begin(), programs_.end(),
+        [&program](const ProgramEntry& entry) {
+          return entry.program == &program;
+        }), programs_.end());
+  }
+
+  /// Sets a function that is called with every program that was reloaded.
+  void onReload(std::function<void(Program&)> callback) {
+    on_reload_ = callback;
+  }
+
+  /// Processes the file changes since the last call, and rebuilds the
+  /// affected shaders and programs. It doesn't block if nothing changed.
+  /** @return The number of programs that were reloaded. */
+  size_t update() {
+    std::set<std::string> changed_files = readEvents();
+    if (changed_files.empty()) {
+      return 0;
+    }
+
+    // Collect the shaders that depend on the changed files.
+    std::set<ShaderEntry*> changed_shaders;
+    for (const std::string& file : changed_files) {
+      ShaderFileCache::Forget(file);
+      auto iter = dependents_.find(file);
+      if (iter != dependents_.end()) {
+        changed_shaders.insert(iter->second.begin(), iter->second.end());
+      }
+    }
+
+    // Start all the compiles before waiting for any of them.
+    std::vector<std::pair<ShaderEntry*, std::unique_ptr<Shader>>> compiled;
+    for (ShaderEntry *entry : changed_shaders) {
+      try {
+        ShaderSource source{entry->path};
+        std::unique_ptr<Shader> shader{new Shader{entry->type, source}};
+        shader->compileAsync();
+        entry->files = source.included_files();
+        compiled.emplace_back(entry, std::move(shader));
+      } catch (const std::runtime_error&) {
+        // The file might be in the middle of being saved, it'll be reloaded
+        // when the editor finishes writing it.
+      }
+    }
+
+    std::set<ShaderEntry*> reloaded_shaders;
+    for (auto& shader : compiled) {
+      shader.second->compile();
+      if (shader.second->state() == Shader::kCompileSuccessful) {
+        shader.first->shader = std::move(shader.second);
+        reloaded_shaders.insert(shader.first);
+      }
+    }
+    updateDependencies();
+
+    // Relink the programs that use the reloaded shaders.
+    size_t reloaded_programs = 0;
+    for (ProgramEntry& entry : programs_) {
+      bool affected = false;
+      for (ShaderEntry *shader : entry.shaders) {
+        affected = affected || reloaded_shaders.count(shader) != 0;
+      }
+      if (!affected) {
+        continue;
+      }
+
+      Program program;
+      for (ShaderEntry *shader : entry.shaders) {
+        program.attachShader(*shader->shader);
+      }
+      program.link();
+      if (program.state() == Program::kLinkSuccessful) {
+        *entry.program = std::move(program);
+        ++reloaded_programs;
+        if (on_reload_) {
+          on_reload_(*entry.program);
+        }
+      }
+    }
+
+    return reloaded_programs;
+  }
+
+  /// Returns the number of shaders that are watched.
+  size_t shader_count() const { return shaders_.size(); }
+
+ private:
+  struct ShaderEntry {
+    ShaderType type;
+    std::string path;
+    std::unique_ptr<Shader> shader;
+    std::vector<std::string> files;  // The loaded files (with the includes).
+  };
+
+  struct ProgramEntry {
+    Program *program;
+    std::vector<ShaderEntry*> shaders;
+  };
+
+  int inotify_;
+  std::vector<std::unique_ptr<ShaderEntry>> shaders_;
+  std::vector<ProgramEntry> programs_;
+  std::function<void(Program&)> on_reload_;
+
+  /// The shaders that depend on a file.
+  std::unordered_map<std::string, std::vector<ShaderEntry*>> dependents_;
+
+  /// The watched directories by their watch descriptors (with a trailing
+  /// slash, or empty for the working directory).
+  std::unordered_map<int, std::string> directories_;
+
+  /// Returns the shader made from a file, and loads it if it isn't loaded yet.
+  ShaderEntry* shader(const ShaderFile& file) {
+    for (const auto& entry : shaders_) {
+      if (entry->type == file.type && entry->path == file.path) {
+        return entry.get();
+      }
+    }
+
+    ShaderSource source{file.path};
+    std::unique_ptr<ShaderEntry> entry{new ShaderEntry{
+        file.type, file.path, std::unique_ptr<Shader>{
+            new Shader{file.type, source}}, source.included_files()}};
+    entry->shader->compileAsync();
+    shaders_.push_back(std::move(entry));
+    updateDependencies();
+    return shaders_.back().get();
+  }
+
+  /// Rebuilds the file -> shader map, and watches the new directories.
+  void updateDependencies() {
+    dependents_.clear();
+    for (const auto& entry : shaders_) {
+      for (const std::string& file : entry->files) {
+        std::vector<ShaderEntry*>& dependents = dependents_[file];
+        if (std::find(dependents.begin(), dependents.end(), entry.get()) ==
+            dependents.end()) {
+          dependents.push_back(entry.get());
+        }
+        watchDirectory(file);
+      }
+    }
+  }
+
+  /// Watches the directory of a file (editors often replace the files
+  /// instead of writing them, so the files themselves can't be watched).
+  void watchDirectory(const std::string& file) {
+    size_t slash = file.find_last_of('/');
+    std::string directory =
+        slash == std::string::npos ? std::string{} : file.substr(0, slash + 1);
+    for (const auto& watched : directories_) {
+      if (watched.second == directory) {
+        return;
+      }
+    }
+
+    int watch = inotify_add_watch(inotify_,
+                                  directory.empty() ? "." : directory.c_str(),
+                                  IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (watch >= 0) {
+      directories_[watch] = directory;
+    }
+  }
+
+  /// Returns the paths of the files that changed since the last call.
+  std::set<std::string> readEvents() {
+    std::set<std::string> changed_files;
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(inotify_, buffer, sizeof(buffer))) > 0) {
+      for (char *ptr = buffer; ptr < buffer + length;) {
+        const inotify_event *event = reinterpret_cast<inotify_event*>(ptr);
+        auto iter = directories_.find(event->wd);
+        if (iter != directories_.end() && event->len > 0) {
+          changed_files.insert(iter->second + event->name);
+        }
+        ptr += sizeof(inotify_event) + event->len;
+      }
+    }
+    return changed_files;
+  }
+};
+#endif  // __linux__ && glCreateShader && glCreateProgram
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_SHADER_WATCHER_H_
@@ -4,6 +4,7 @@
 #define OGLWRAP_SHAPES_SPHERE_SHAPE_INL_H_
 
 #include <set>
+#include <cassert>
 #include <vector>
 #include <algorithm>
 #include "./sphere_shape.h"
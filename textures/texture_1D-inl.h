@@ -36,26 +36,40 @@ inline void Texture1D::uploadMipmap(GLint level,
 inline void Texture1D::subUpload(GLint x_offset, GLsizei width,
                                  PixelDataFormat format, PixelDataType type,
                                  const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage1D(this->expose(), 0, x_offset, width,
+                       GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage1D(GL_TEXTURE_1D, 0, x_offset, width,
                    GLenum(format), GLenum(type), data));
+#endif
 }
 
 inline void Texture1D::subUploadMipmap(GLint level, GLint x_offset,
                                        GLsizei width, PixelDataFormat format,
                                        PixelDataType type,
                                        const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage1D(this->expose(), level, x_offset, width,
+                       GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage1D(GL_TEXTURE_1D, level, x_offset, width,
                    GLenum(format), GLenum(type), data));
+#endif
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glTexStorage1D)
 inline void Texture1D::storage(GLsizei levels, GLenum internal_format,
                                GLsizei width) {
-  OGLWRAP_CHECK_BINDING();
   OGLWRAP_CHECK_BINDLESS_TEXTURE_MODIFIED(this->bindless_handle_);
+#if OGLWRAP_USE_DSA
+  gl(TextureStorage1D(this->expose(), levels, GLenum(internal_format), width));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(TexStorage1D(GL_TEXTURE_1D, levels, GLenum(internal_format), width));
+#endif
 }
 #endif  // glTexStorage1D
 
@@ -74,20 +88,32 @@ inline void Texture1D::copyMipmap(GLint level,
 
 inline void Texture1D::copySub(GLint x_offset, GLint x, GLint y,
                                GLsizei width) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage1D(this->expose(), 0, x_offset, x, y, width));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage1D(GL_TEXTURE_1D, 0, x_offset, x, y, width));
+#endif
 }
 
 inline void Texture1D::copySubMipmap(GLint level, GLint x_offset, GLint x,
                                      GLint y, GLsizei width) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage1D(this->expose(), level, x_offset, x, y, width));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage1D(GL_TEXTURE_1D, level, x_offset, x, y, width));
+#endif
 }
 
 inline GLsizei Texture1D::width(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei w;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_WIDTH, &w));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GL_TEXTURE_1D, level, GL_TEXTURE_WIDTH, &w));
+#endif
   return w;
 }
 
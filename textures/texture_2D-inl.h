@@ -35,28 +35,43 @@ template<Texture2DType texture_t>
 void Texture2DBase<texture_t>::subUpload(
     GLint x_offset, GLint y_offset, GLsizei width, GLsizei height,
     PixelDataFormat format, PixelDataType type, const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage2D(this->expose(), 0, x_offset, y_offset,
+                       width, height, GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage2D(GLenum(texture_t), 0, x_offset, y_offset,
                    width, height, GLenum(format), GLenum(type), data));
+#endif
 }
 
 template<Texture2DType texture_t>
 void Texture2DBase<texture_t>::subUploadMipmap(
     GLint level, GLint x_offset, GLint y_offset, GLsizei width, GLsizei height,
     PixelDataFormat format, PixelDataType type, const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage2D(this->expose(), level, x_offset, y_offset,
+                       width, height, GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage2D(GLenum(texture_t), level, x_offset, y_offset,
                    width, height, GLenum(format), GLenum(type), data));
+#endif
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glTexStorage2D)
 template<Texture2DType texture_t>
 void Texture2DBase<texture_t>::storage(GLsizei levels, GLenum internal_format,
                                        GLsizei width, GLsizei height) {
-  OGLWRAP_CHECK_BINDING();
   OGLWRAP_CHECK_BINDLESS_TEXTURE_MODIFIED(this->bindless_handle_);
+#if OGLWRAP_USE_DSA
+  gl(TextureStorage2D(this->expose(), levels, GLenum(internal_format),
+                      width, height));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(TexStorage2D(GLenum(texture_t), levels, GLenum(internal_format),
                   width, height));
+#endif
 }
 #endif  // glTexStorage2D
 
@@ -82,33 +97,53 @@ template<Texture2DType texture_t>
 void Texture2DBase<texture_t>::copySub(
     GLint x_offset, GLint y_offset, GLint x,
     GLint y, GLsizei width, GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage2D(this->expose(), 0, x_offset, y_offset,
+                           x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage2D(GLenum(texture_t), 0, x_offset, y_offset,
                        x, y, width, height));
+#endif
 }
 
 template<Texture2DType texture_t>
 void Texture2DBase<texture_t>::copySubMipmap(
     GLint level, GLint x_offset, GLint y_offset,
     GLint x, GLint y, GLsizei width, GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage2D(this->expose(), level, x_offset, y_offset,
+                           x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage2D(GLenum(texture_t), level, x_offset, y_offset,
                        x, y, width, height));
+#endif
 }
 
 template<Texture2DType texture_t>
 GLsizei Texture2DBase<texture_t>::width(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_WIDTH,
+                                &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(texture_t), level, GL_TEXTURE_WIDTH, &data));
+#endif
   return data;
 }
 
 template<Texture2DType texture_t>
 GLsizei Texture2DBase<texture_t>::height(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_HEIGHT,
+                                &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(texture_t), level, GL_TEXTURE_HEIGHT, &data));
+#endif
   return data;
 }
 
@@ -43,9 +43,14 @@ void Texture3DBase<texture_t>::subUpload(
     GLint x_offset, GLint y_offset, GLint z_offset, GLsizei width,
     GLsizei height, GLsizei depth, PixelDataFormat format, PixelDataType type,
     const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage3D(this->expose(), 0, x_offset, y_offset, z_offset, width,
+                       height, depth, GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage3D(GLenum(texture_t), 0, x_offset, y_offset, z_offset, width,
                    height, depth, GLenum(format), GLenum(type), data));
+#endif
 }
 
 template<Texture3DType texture_t>
@@ -53,9 +58,15 @@ void Texture3DBase<texture_t>::subUploadMipmap(
     GLint level, GLint x_offset, GLint y_offset, GLint z_offset, GLsizei width,
     GLsizei height, GLsizei depth, PixelDataFormat format, PixelDataType type,
     const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage3D(this->expose(), level, x_offset, y_offset, z_offset,
+                       width, height, depth, GLenum(format), GLenum(type),
+                       data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage3D(GLenum(texture_t), level, x_offset, y_offset, z_offset, width,
                    height, depth, GLenum(format), GLenum(type), data));
+#endif
 }
 #endif  // glTexSubImage3D
 
@@ -64,9 +75,14 @@ template<Texture3DType texture_t>
 void Texture3DBase<texture_t>::copySub(GLint x_offset, GLint y_offset,
                                        GLint z_offset, GLint x, GLint y,
                                        GLsizei width, GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage3D(this->expose(), 0, x_offset, y_offset, z_offset,
+                           x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage3D(GLenum(texture_t), 0, x_offset, y_offset, z_offset, x, y,
                        width, height));
+#endif
 }
 
 template<Texture3DType texture_t>
@@ -74,9 +90,14 @@ void Texture3DBase<texture_t>::copySubMipmap(GLint level, GLint x_offset,
                                              GLint y_offset, GLint z_offset,
                                              GLint x, GLint y, GLsizei width,
                                              GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage3D(this->expose(), level, x_offset, y_offset,
+                           z_offset, x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage3D(GLenum(texture_t), level, x_offset, y_offset, z_offset, x,
                        y, width, height));
+#endif
 }
 #endif  // glCopyTexSubImage3D
 
@@ -85,35 +106,55 @@ template<Texture3DType texture_t>
 void Texture3DBase<texture_t>::storage(
     GLsizei levels, PixelDataInternalFormat internal_format, GLsizei width,
     GLsizei height, GLsizei depth) {
-  OGLWRAP_CHECK_BINDING();
   OGLWRAP_CHECK_BINDLESS_TEXTURE_MODIFIED(this->bindless_handle_);
+#if OGLWRAP_USE_DSA
+  gl(TextureStorage3D(this->expose(), levels, GLenum(internal_format), width,
+                      height, depth));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(TexStorage3D(GLenum(texture_t), levels, GLenum(internal_format), width,
                   height, depth));
+#endif
 }
 #endif  // glTexStorage3D
 
 template<Texture3DType texture_t>
 GLsizei Texture3DBase<texture_t>::width(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_WIDTH,
+                                &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(texture_t), level, GL_TEXTURE_WIDTH, &data));
+#endif
   return data;
 }
 
 template<Texture3DType texture_t>
 GLsizei Texture3DBase<texture_t>::height(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_HEIGHT,
+                                &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(texture_t), level, GL_TEXTURE_HEIGHT, &data));
+#endif
   return data;
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_TEXTURE_DEPTH)
 template<Texture3DType texture_t>
 GLsizei Texture3DBase<texture_t>::depth(GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  gl(GetTextureLevelParameteriv(this->expose(), level, GL_TEXTURE_DEPTH,
+                                &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(texture_t), level, GL_TEXTURE_DEPTH, &data));
+#endif
   return data;
 }
 #endif
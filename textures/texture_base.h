@@ -42,7 +42,11 @@ template <TextureType texture_t>
 class TextureBase {
  public:
   /// Creates a new texture
+#if OGLWRAP_USE_DSA
+  TextureBase() : texture_{texture_t} {}
+#else
   TextureBase() = default;
+#endif
 
   /// Moves a texture
   TextureBase(TextureBase&&) noexcept = default;
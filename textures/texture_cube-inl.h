@@ -39,9 +39,14 @@ inline void TextureCube::subUpload(TextureCubeTarget target, GLint x_offset,
                                    GLint y_offset, GLsizei width, GLsizei height,
                                    PixelDataFormat format, PixelDataType type,
                                    const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage3D(expose(), 0, x_offset, y_offset, faceIndex(target),
+                       width, height, 1, GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage2D(GLenum(target), 0, x_offset, y_offset, width, height,
                    GLenum(format), GLenum(type), data));
+#endif
 }
 
 inline void TextureCube::subUploadMipmap(TextureCubeTarget target, GLint level,
@@ -50,19 +55,31 @@ inline void TextureCube::subUploadMipmap(TextureCubeTarget target, GLint level,
                                          PixelDataFormat format,
                                          PixelDataType type,
                                          const void *data) {
+#if OGLWRAP_USE_DSA
+  gl(TextureSubImage3D(expose(), level, x_offset, y_offset, faceIndex(target),
+                       width, height, 1, GLenum(format), GLenum(type), data));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(TexSubImage2D(GLenum(target), level, x_offset, y_offset, width,
                    height, GLenum(format), GLenum(type), data));
+#endif
 }
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glTexStorage2D)
 inline void TextureCube::storage(TextureCubeTarget target, GLsizei levels,
                                  GLenum internal_format, GLsizei width,
                                  GLsizei height) {
-  OGLWRAP_CHECK_BINDING();
   OGLWRAP_CHECK_BINDLESS_TEXTURE_MODIFIED(this->bindless_handle_);
+#if OGLWRAP_USE_DSA
+  // The storage is allocated for all the six faces at once.
+  (void)target;
+  gl(TextureStorage2D(expose(), levels, GLenum(internal_format),
+                      width, height));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(TexStorage2D(GLenum(target), levels, GLenum(internal_format),
                   width, height));
+#endif
 }
 #endif  // glTexStorage2D
 
@@ -86,34 +103,60 @@ inline void TextureCube::copyMipmap(TextureCubeTarget target, GLint level,
 inline void TextureCube::copySub(TextureCubeTarget target, GLint x_offset,
                                  GLint y_offset, GLint x, GLint y,
                                  GLsizei width, GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage3D(expose(), 0, x_offset, y_offset, faceIndex(target),
+                           x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage2D(GLenum(target), 0, x_offset, y_offset,
                        x, y, width, height));
+#endif
 }
 
 inline void TextureCube::copySubMipmap(TextureCubeTarget target, GLint level,
                                        GLint x_offset, GLint y_offset, GLint x,
                                        GLint y, GLsizei width,
                                        GLsizei height) {
+#if OGLWRAP_USE_DSA
+  gl(CopyTextureSubImage3D(expose(), level, x_offset, y_offset,
+                           faceIndex(target), x, y, width, height));
+#else
   OGLWRAP_CHECK_BINDING();
   gl(CopyTexSubImage2D(GLenum(target), level, x_offset, y_offset,
                    x, y, width, height));
+#endif
 }
 
 inline GLsizei TextureCube::width(TextureCubeTarget target, GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  // Every face of a cube map has the same size.
+  (void)target;
+  gl(GetTextureLevelParameteriv(expose(), level, GL_TEXTURE_WIDTH, &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(target), level, GL_TEXTURE_WIDTH, &data));
+#endif
   return data;
 }
 
 inline GLsizei TextureCube::height(TextureCubeTarget target, GLint level) const {
-  OGLWRAP_CHECK_BINDING();
   GLsizei data;
+#if OGLWRAP_USE_DSA
+  // Every face of a cube map has the same size.
+  (void)target;
+  gl(GetTextureLevelParameteriv(expose(), level, GL_TEXTURE_HEIGHT, &data));
+#else
+  OGLWRAP_CHECK_BINDING();
   gl(GetTexLevelParameteriv(GLenum(target), level, GL_TEXTURE_HEIGHT, &data));
+#endif
   return data;
 }
 
+inline GLint TextureCube::faceIndex(TextureCubeTarget target) {
+  return GLenum(target) - GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+}
+
 inline TextureCubeTarget TextureCube::cubeFace(int face_id) {
   switch (face_id) {
     case 0: return TextureCubeTarget::kTextureCubeMapPositiveX;
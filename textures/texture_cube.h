@@ -142,6 +142,10 @@ class TextureCube : public TextureBase<TextureType::kTextureCubeMap> {
   /** @param i - The index of the TextureCubeTarget to return */
   static TextureCubeTarget cubeFace(int i);
 
+  /// Returns the index of a cube side (the inverse of cubeFace).
+  /** @param target - The cube side whose index should be returned */
+  static GLint faceIndex(TextureCubeTarget target);
+
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetCompressedTexImage)
   /// Return the compressed texture image of one side
   /** @param target - Specifies which one of the six sides of the cube to use as target.
@@ -0,0 +1,151 @@
+// Copyright (c) Tamas Csala
+
+/** @file transient_allocator.h
+    @brief Implements a per frame linear allocator for uniform and shader
+           storage block data.
+*/
+
+#ifndef OGLWRAP_TRANSIENT_ALLOCATOR_H_
+#define OGLWRAP_TRANSIENT_ALLOCATOR_H_
+
+#include <cstring>
+
+#include "./config.h"
+#include "./buffer.h"
+#include "./ring_buffer.h"
+#include "./uniform_block.h"
+#include "context/binding.h"
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glBufferStorage) \
+    && defined(glMapBufferRange) && defined(glUnmapBuffer) \
+    && defined(glFenceSync) && defined(glClientWaitSync) \
+    && defined(glBindBufferRange))
+
+/// Returns the required alignment of the offsets bound with glBindBufferRange.
+/** @see GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+  *      GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT */
+inline GLint OGLWRAP_GetOffsetAlignment(IndexedBufferType buffer_type) {
+  GLint alignment = 1;
+  switch (buffer_type) {
+  #if OGLWRAP_DEFINE_EVERYTHING || defined(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+    case IndexedBufferType::kUniformBuffer:
+      gl(GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment));
+      break;
+  #endif
+  #if OGLWRAP_DEFINE_EVERYTHING || \
+      defined(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT)
+    case IndexedBufferType::kShaderStorageBuffer:
+      gl(GetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment));
+      break;
+  #endif
+    default:
+      break;
+  }
+  return alignment < 1 ? 1 : alignment;
+}
+
+template<IndexedBufferType BUFFER_TYPE, BlockLayout LAYOUT>
+/// A linear allocator, that hands out slices of a large buffer for per draw
+/// block data.
+/** The slices are allocated from a persistently mapped RingBuffer, so filling
+  * them is a plain memory write, and every slice's offset respects the offset
+  * alignment of the binding target. A slice is used by binding it to an
+  * indexed binding point with glBindBufferRange, instead of updating a small
+  * buffer with glBufferSubData for every draw call.
+  *
+  * nextFrame() has to be called at the end of every frame. It resets the
+  * allocator to the next region of the ring buffer, after waiting for the
+  * fence of the frame that last used that region.
+  * @see TransientUniformAllocator, TransientStorageAllocator */
+class TransientAllocator {
+ public:
+  /// A part of the buffer that was handed out for the current frame.
+  typedef typename RingBuffer<BufferType(BUFFER_TYPE)>::Range Slice;
+
+  /// Creates the buffer and queries the offset alignment.
+  /** @param frame_size   The number of bytes that can be allocated every frame.
+    * @param frame_count  The number of frames that can be in flight. */
+  explicit TransientAllocator(GLsizeiptr frame_size, unsigned frame_count = 3)
+      : ring_(frame_size, frame_count)
+      , alignment_(OGLWRAP_GetOffsetAlignment(BUFFER_TYPE)) { }
+
+  /// Hands out an aligned, writeable slice of size bytes.
+  /** Throws std::length_error if the current frame's region is full. */
+  Slice allocate(GLsizeiptr size) {
+    return ring_.allocate(size, alignment_);
+  }
+
+  /// Allocates a slice, and copies size bytes of data into it.
+  Slice push(const void *data, GLsizeiptr size) {
+    Slice slice = allocate(size);
+    std::memcpy(slice.data, data, size);
+    return slice;
+  }
+
+  /// Allocates a slice, and packs a struct described by BlockFields into it
+  /// with the allocator's block layout.
+  template<typename Struct>
+  Slice pushBlock(const Struct& value) {
+    typedef BlockStructLayout<LAYOUT, typename Struct::Fields> Layout;
+    Slice slice = allocate(Layout::kSize);
+    Layout::Pack(value, slice.template as<unsigned char>());
+    return slice;
+  }
+
+  /// Binds a slice to an indexed binding point.
+  /** @see glBindBufferRange */
+  void bind(const Slice& slice, GLuint index) const {
+    BindRange(BUFFER_TYPE, index, ring_.expose(), slice.offset, slice.size);
+  }
+
+  /// Finishes the current frame, and waits until the next region is free.
+  /** It has to be called after the draw calls that use the current frame's
+    * slices were issued.
+    * @see glFenceSync, glClientWaitSync */
+  void nextFrame() {
+    ring_.nextFrame();
+  }
+
+  /// Returns the alignment of the slices' offsets in bytes.
+  GLsizeiptr alignment() const { return alignment_; }
+
+  /// Returns the number of bytes that are already handed out this frame.
+  GLsizeiptr used() const { return ring_.used(); }
+
+  /// Returns the underlying ring buffer.
+  const RingBuffer<BufferType(BUFFER_TYPE)>& ringBuffer() const {
+    return ring_;
+  }
+
+  /// Returns the handle for the buffer.
+  const glObject& expose() const { return ring_.expose(); }
+
+ private:
+  RingBuffer<BufferType(BUFFER_TYPE)> ring_;
+  const GLsizeiptr alignment_;
+};
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_UNIFORM_BUFFER)
+/// A TransientAllocator for std140 uniform block data.
+using TransientUniformAllocator =
+    TransientAllocator<IndexedBufferType::kUniformBuffer, BlockLayout::kStd140>;
+#endif  // GL_UNIFORM_BUFFER
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_SHADER_STORAGE_BUFFER)
+/// A TransientAllocator for std430 shader storage block data.
+using TransientStorageAllocator =
+    TransientAllocator<IndexedBufferType::kShaderStorageBuffer,
+                       BlockLayout::kStd430>;
+#endif  // GL_SHADER_STORAGE_BUFFER
+
+#endif  // glBufferStorage && glMapBufferRange && ... && glBindBufferRange
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_TRANSIENT_ALLOCATOR_H_
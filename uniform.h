@@ -7,11 +7,13 @@
 #ifndef OGLWRAP_UNIFORM_H_
 #define OGLWRAP_UNIFORM_H_
 
+#include <string>
 #include <stdexcept>
 
 #include "./config.h"
 #include "./program.h"
 #include "context/binding.h"
+#include "context/uniform_cache.h"
 
 #define GLM_FORCE_RADIANS
 #include <glm/glm.hpp>
@@ -42,73 +44,127 @@ class UniformObject {
   template<class T>
   friend class UniformObject;
 
+  /// Records the value in the UniformCache.
+  /** @return false if the uniform already has this value, so the upload can
+    *         be skipped. */
+  bool cacheValue(const GLtype& value, unsigned count) const {
+    return CacheValue(program_.expose(), GLint(location_), value, count);
+  }
+
+  /// Copies the uniform's value from the UniformCache if it's known.
+  bool cachedValue(GLtype *value) const {
+    return UniformCache::Get(program_.expose(), GLint(location_),
+                             value, sizeof(GLtype));
+  }
+
  public:
-  virtual ~UniformObject() {}
+  /// Records the value of a uniform of a program in the UniformCache.
+  /** @return false if the uniform already has this value, so the upload can
+    *         be skipped. */
+  static bool CacheValue(GLuint program, GLint location,
+                         const GLtype& value, unsigned count) {
+  #if OGLWRAP_USE_UNIFORM_CACHE
+    if (count != 1) {
+      UniformCache::Forget(program, location, count);
+      return true;
+    }
+    return UniformCache::Update(program, location, &value, sizeof(GLtype));
+  #else
+    (void)program;
+    (void)location;
+    (void)value;
+    (void)count;
+    return true;
+  #endif
+  }
 
-  /// Sets the uniform to a GLtype variable's value.
-  /** It finds the appropriate glUniform* using template specialization.
-    * @param value - The value to set the uniform.
+  /// Sets the uniform at a location of the currently used program.
+  /** See the specializations at the end of this file.
+    * @param location - The location of the uniform.
+    * @param value - The value (or the first value of an array) to set.
+    * @param count - The number of array elements to set.
     * @see glUniform* */
-  virtual void set(const GLtype& value, unsigned count = 1) { // See the specializations at the end of this file.
+  static void Upload(GLint location, const GLtype& value, unsigned count) {
     static_assert((sizeof(GLtype), false),
         "Trying to set a uniform to a value that is not an OpenGL type.");
   }
 
-  template<typename ArrayOfGLType>
-  /// Sets the uniform to an array of GLtype variables' value.
-  /** It finds the appropriate glUniform* using template specialization.
-    * @param values - The value to set the uniform.
-    * @see glUniform* */
-  auto set(const ArrayOfGLType& values) -> std::enable_if<sizeof(std::end(values) - std::begin(values)) != 0, void> {
-    auto begin_iter = std::begin(values);
-    auto end_iter   = std::end(values);
-
-    set(*begin_iter, end_iter - begin_iter);
+  /// Sets the uniform at a location of a program, that doesn't have to be in
+  /// use.
+  /** See the specializations at the end of this file.
+    * @see glProgramUniform* */
+  static void ProgramUpload(GLuint program, GLint location,
+                            const GLtype& value, unsigned count) {
+    static_assert((sizeof(GLtype), false),
+        "Trying to set a uniform to a value that is not an OpenGL type.");
   }
 
-  template<typename T>
-  /// Sets the uniform to a GLtype variable's value.
-  /** It finds the appropriate glUniform* using template specialization.
-    * If it is called with not an OpenGL type, it throws std::invalid_argument.
-    * @param value - The value to set the uniform.
-    * @see glUniform* */
-  void operator=(const T& value) {
-    set(value);
+  /// Sets the uniform at a location of a program.
+  /** Uses glProgramUniform* if OGLWRAP_USE_PROGRAM_UNIFORM is true, otherwise
+    * the program has to be in use. */
+  static void Upload(GLuint program, GLint location,
+                     const GLtype& value, unsigned count) {
+  #if OGLWRAP_USE_PROGRAM_UNIFORM
+    ProgramUpload(program, location, value, count);
+  #else
+    (void)program;
+    Upload(location, value, count);
+  #endif
   }
 
-  /// Gets the current value of the uniform.
-  /** It finds the appropriate glGetUniform* using template specialization.
-    * If it is called with not an OpenGL type, it throws std::invalid_argument.
-    * @return The current value of the uniform.
-    * @see glUniform* */
-  virtual GLtype get() const {
+  /// Gets the value of the uniform at a location of a program.
+  /** See the specializations at the end of this file.
+    * @see glGetUniform* */
+  static GLtype Download(GLuint program, GLint location) {
     static_assert((sizeof(GLtype), false),
         "Trying to get a uniform to a value that is not an OpenGL type.");
   }
 
-  /// Gets the current value of the uniform.
-  /** It finds the appropriate glGetUniform* using template specialization.
-    * If it is called with not an OpenGL type, it throws std::invalid_argument.
-    * @return The current value of the uniform.
-    * @see glUniform* */
-  operator GLtype() {
-    return get();
-  }
-
   /// Returns the C OpenGL handle for the uniform's location.
   GLuint expose() const {
     return location_;
   }
 };
 
+// -------======{[ UniformBase ]}======-------
+
+template<typename GLtype, typename Derived>
+/// Implements the setters that are common for the Uniforms.
+/** The Uniforms derive from it with themselves as the Derived parameter, so
+  * the calls are resolved at compile time (there are no virtual functions),
+  * and an upload can inline down to a single glUniform* call. */
+class UniformBase : public UniformObject<GLtype> {
+ protected:
+  /// Creates a UniformBase
+  /// @param program - The program in which the uniform is used
+  explicit UniformBase(const Program& program)
+    : UniformObject<GLtype>(program) { }
+
+ public:
+  template<typename ArrayOfGLType>
+  /// Sets the uniform to an array of GLtype variables' value.
+  /** It finds the appropriate glUniform* using template specialization.
+    * @param values - The value to set the uniform.
+    * @see glUniform* */
+  auto set(const ArrayOfGLType& values)
+      -> typename std::enable_if<sizeof(std::end(values) - std::begin(values)) != 0>::type {
+    auto begin_iter = std::begin(values);
+    auto end_iter   = std::end(values);
+
+    static_cast<Derived*>(this)->set(*begin_iter, end_iter - begin_iter);
+  }
+};
+
 // -------======{[ Uniform ]}======-------
 
 template<typename GLtype>
 /// Uniform is used to set a uniform variable's value in a specified program.
 /** It queries the location of the uniform in the constructor and also notifies on the
   * stderr, if getting the location of the variable, or setting it didn't work. */
-class Uniform : public UniformObject<GLtype> {
-  const std::string identifier_;
+class Uniform : public UniformBase<GLtype, Uniform<GLtype>> {
+#if OGLWRAP_DEBUG
+  const std::string identifier_;  // Only stored for the error messages.
+#endif
 
  public:
   /// Queries a variable named 'identifier' in the 'program', and stores it's location.
@@ -117,12 +173,16 @@ class Uniform : public UniformObject<GLtype> {
     * @param identifier - The name of the uniform that is to be set.
     * @see glGetUniformLocation */
   Uniform(const Program& program, const std::string& identifier)
-      : UniformObject<GLtype>(program)
-      , identifier_(identifier) {
-    OGLWRAP_CHECK_BINDING_EXPLICIT(program);
+      : UniformBase<GLtype, Uniform<GLtype>>(program)
+  #if OGLWRAP_DEBUG
+      , identifier_(identifier)
+  #endif
+  {
+    #if !OGLWRAP_USE_PROGRAM_UNIFORM
+      OGLWRAP_CHECK_BINDING_EXPLICIT(program);
+    #endif
 
-    this->location_ =
-      gl(GetUniformLocation(program.expose(), identifier_.c_str()));
+    this->location_ = program.uniformLocation(identifier.c_str());
 
     #if OGLWRAP_DEBUG
       if (this->location_ == this->kInvalidLocation) {
@@ -139,8 +199,12 @@ class Uniform : public UniformObject<GLtype> {
   /** It throws std::invalid_argument if it is an unrecognized type.
     * @param value - Specifies the new value to be used for the uniform variable.
     * @see glUniform* */
-  virtual void set(const GLtype& value, unsigned count = 1) override {
-    glfunc(UniformObject<GLtype>::set(value, count));
+  void set(const GLtype& value, unsigned count = 1) {
+    if (!this->cacheValue(value, count)) {
+      return;
+    }
+
+    glfunc(this->Upload(this->program_.expose(), this->location_, value, count));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -154,7 +218,7 @@ class Uniform : public UniformObject<GLtype> {
     #endif
   }
 
-  using UniformObject<GLtype>::set;
+  using UniformBase<GLtype, Uniform<GLtype>>::set;
 
   template<typename T>
   /// Sets the uniform to value if it is an OpenGL type or a glm vector or matrix.
@@ -170,8 +234,13 @@ class Uniform : public UniformObject<GLtype> {
     * If it is called with not an OpenGL type, it throws std::invalid_argument.
     * @return The current value of the uniform.
     * @see glUniform* */
-  virtual GLtype get() const override {
-    GLtype val = glfunc(UniformObject<GLtype>::get());
+  GLtype get() const {
+    GLtype val;
+    if (this->cachedValue(&val)) {
+      return val;
+    }
+
+    val = glfunc(this->Download(this->program_.expose(), this->location_));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -206,8 +275,10 @@ template<typename GLtype>
 /// IndexedUniform is used to set an element of a uniform array in a specified program.
 /** It queries the location of the uniform in the constructor and also notifies on the
     stderr, if getting the location of the variable, or setting it didn't work. */
-class IndexedUniform : public UniformObject<GLtype> {
-  std::string identifier_;
+class IndexedUniform : public UniformBase<GLtype, IndexedUniform<GLtype>> {
+#if OGLWRAP_DEBUG
+  std::string identifier_;  // Only stored for the error messages.
+#endif
 
  public:
   /// Queries a variable named 'identifier' in the 'program', and stores it's location.
@@ -217,15 +288,18 @@ class IndexedUniform : public UniformObject<GLtype> {
     * @param idx - The index of the element in the uniform array.
     * @see glGetUniformLocation */
   IndexedUniform(const Program& program, const std::string& identifier, size_t idx)
-      : UniformObject<GLtype>(program) {
-    std::stringstream id;
-    id << identifier << '[' << idx << ']';
-    identifier_ = id.str();
+      : UniformBase<GLtype, IndexedUniform<GLtype>>(program) {
+    std::string name = identifier + '[' + std::to_string(idx) + ']';
 
-    OGLWRAP_CHECK_BINDING_EXPLICIT(program);
+    #if !OGLWRAP_USE_PROGRAM_UNIFORM
+      OGLWRAP_CHECK_BINDING_EXPLICIT(program);
+    #endif
+
+    this->location_ = program.uniformLocation(name.c_str());
 
-    this->location_ =
-      gl(GetUniformLocation(program.expose(), id.str().c_str()));
+    #if OGLWRAP_DEBUG
+      identifier_ = std::move(name);
+    #endif
 
     #if OGLWRAP_DEBUG
       if (this->location_ == this->kInvalidLocation) {
@@ -242,8 +316,12 @@ class IndexedUniform : public UniformObject<GLtype> {
   /** It throws std::invalid_argument if it is an unrecognized type.
     * @param value - Specifies the new value to be used for the uniform variable.
     * @see glUniform* */
-  virtual void set(const GLtype& value, unsigned count = 1) override {
-    glfunc(UniformObject<GLtype>::set(value, count));
+  void set(const GLtype& value, unsigned count = 1) {
+    if (!this->cacheValue(value, count)) {
+      return;
+    }
+
+    glfunc(this->Upload(this->program_.expose(), this->location_, value, count));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -257,7 +335,7 @@ class IndexedUniform : public UniformObject<GLtype> {
     #endif
   }
 
-  using UniformObject<GLtype>::set;
+  using UniformBase<GLtype, IndexedUniform<GLtype>>::set;
 
   template<typename T>
   /// Sets the uniform to value if it is an OpenGL type or a glm vector or matrix.
@@ -273,8 +351,13 @@ class IndexedUniform : public UniformObject<GLtype> {
     * If it is called with not an OpenGL type, it throws std::invalid_argument.
     * @return The current value of the uniform.
     * @see glUniform* */
-  virtual GLtype get() const override {
-    GLtype val = glfunc(UniformObject<GLtype>::get());
+  GLtype get() const {
+    GLtype val;
+    if (this->cachedValue(&val)) {
+      return val;
+    }
+
+    val = glfunc(this->Download(this->program_.expose(), this->location_));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -313,7 +396,7 @@ template<typename GLtype>
   * Uniform class works. It also has the advantage, that you only have
   * to write program's and the uniform's name once, no matter how many
   * times you set it. */
-class LazyUniform : public UniformObject<GLtype> {
+class LazyUniform : public UniformBase<GLtype, LazyUniform<GLtype>> {
   const std::string identifier_;  // The uniform's name.
   mutable bool firstCall_;
 
@@ -324,7 +407,7 @@ class LazyUniform : public UniformObject<GLtype> {
     * @param program - The program in which the uniform is to be set.
     * @param identifier - The uniform's name. */
   LazyUniform(const Program& program, const std::string& identifier)
-    : UniformObject<GLtype>(program)
+    : UniformBase<GLtype, LazyUniform<GLtype>>(program)
     , identifier_(identifier)
     , firstCall_(true) {
   }
@@ -334,13 +417,14 @@ class LazyUniform : public UniformObject<GLtype> {
     * It writes to stderr if it was unable to get it.
     * At every call it sets the uniform to the specified value.
     * @param value - Specifies the new value to be used for the uniform variable. */
-  virtual void set(const GLtype& value, unsigned count = 1) override {
-    OGLWRAP_CHECK_BINDING_EXPLICIT(this->program_);
+  void set(const GLtype& value, unsigned count = 1) {
+    #if !OGLWRAP_USE_PROGRAM_UNIFORM
+      OGLWRAP_CHECK_BINDING_EXPLICIT(this->program_);
+    #endif
 
     // Get the uniform's location only at the first set call.
     if (firstCall_) {
-      this->location_ =
-        gl(GetUniformLocation(this->program_.expose(), identifier_.c_str()));
+      this->location_ = this->program_.uniformLocation(identifier_.c_str());
 
       #if OGLWRAP_DEBUG
         // Check if it worked.
@@ -356,7 +440,11 @@ class LazyUniform : public UniformObject<GLtype> {
       firstCall_ = false;
     }
 
-    glfunc(UniformObject<GLtype>::set(value, count));
+    if (!this->cacheValue(value, count)) {
+      return;
+    }
+
+    glfunc(this->Upload(this->program_.expose(), this->location_, value, count));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -370,7 +458,7 @@ class LazyUniform : public UniformObject<GLtype> {
     #endif
   }
 
-  using UniformObject<GLtype>::set;
+  using UniformBase<GLtype, LazyUniform<GLtype>>::set;
 
   template<typename T>
   /// Sets the uniforms value.
@@ -387,13 +475,14 @@ class LazyUniform : public UniformObject<GLtype> {
     * If it is called with not an OpenGL type, it throws std::invalid_argument.
     * @return The current value of the uniform.
     * @see glUniform* */
-  GLtype get() const override {
-    OGLWRAP_CHECK_BINDING_EXPLICIT(this->program_);
+  GLtype get() const {
+    #if !OGLWRAP_USE_PROGRAM_UNIFORM
+      OGLWRAP_CHECK_BINDING_EXPLICIT(this->program_);
+    #endif
 
     // Get the uniform's location only at the first set call.
     if (firstCall_) {
-      this->location_ = gl(GetUniformLocation(
-          this->program_.expose(), identifier_.c_str()));
+      this->location_ = this->program_.uniformLocation(identifier_.c_str());
 
       #if OGLWRAP_DEBUG
         // Check if it worked.
@@ -409,7 +498,12 @@ class LazyUniform : public UniformObject<GLtype> {
       firstCall_ = false;
     }
 
-    GLtype val = glfunc(UniformObject<GLtype>::get());
+    GLtype val;
+    if (this->cachedValue(&val)) {
+      return val;
+    }
+
+    val = glfunc(this->Download(this->program_.expose(), this->location_));
 
     #if OGLWRAP_DEBUG
       OGLWRAP_PRINT_IF_ERROR(
@@ -444,322 +538,674 @@ class LazyUniform : public UniformObject<GLtype> {
 /// A LazyUniform that sets a sampler.
 typedef LazyUniform<GLint> LazyUniformSampler;
 
+// -------======{[ UniformHandle ]}======-------
+
+template<typename GLtype>
+/// A small, trivially copyable reference to a uniform of a program.
+/** Unlike Uniform, it doesn't store the program object and the uniform's name
+  * as a string, only the program's handle and the uniform's location (and a
+  * pointer to the name in debug builds), so it's 8 bytes (16 in debug builds),
+  * and can be stored in large arrays, and copied with memcpy. The name has to
+  * be a string literal, its hash is computed at compile time, and the location
+  * is looked up with it in the program's reflection table (if
+  * OGLWRAP_USE_PROGRAM_REFLECTION is true).
+  *
+  * The program has to be in use when the uniform is set, unless
+  * OGLWRAP_USE_PROGRAM_UNIFORM is true. */
+class UniformHandle {
+ public:
+  /// Creates a handle that doesn't refer to any uniform.
+  UniformHandle()
+      : program_(0), location_(-1)
+  #if OGLWRAP_DEBUG
+      , name_("")
+  #endif
+  { }
+
+  /// Looks up the location of the uniform named 'name' in the 'program'.
+  /** It writes to stderr if the uniform isn't active in the program.
+    * @param program - The linked program to seek the uniform in.
+    * @param name - The name of the uniform (a string literal).
+    * @see glGetUniformLocation */
+  UniformHandle(const Program& program, const UniformName& name)
+      : program_(program.expose())
+      , location_(program.uniformLocation(name))
+  #if OGLWRAP_DEBUG
+      , name_(name.str)
+  #endif
+  {
+    #if OGLWRAP_DEBUG
+      if (location_ == -1) {
+        OGLWRAP_PRINT_ERROR(
+          "Error getting uniform location",
+          std::string{"Error getting the location of uniform '"} + name_ +
+          "' in the program using the following shaders:\n" +
+          program.getShaderNames());
+      }
+    #endif
+  }
+
+  /// Sets the uniform to value.
+  /** The program has to be in use, unless OGLWRAP_USE_PROGRAM_UNIFORM is true.
+    * @param value - The value (or the first element of an array) to set.
+    * @param count - The number of array elements to set.
+    * @see glUniform*, glProgramUniform* */
+  void set(const GLtype& value, unsigned count = 1) const {
+    if (!UniformObject<GLtype>::CacheValue(program_, location_, value, count)) {
+      return;
+    }
+
+    glfunc(UniformObject<GLtype>::Upload(program_, location_, value,
+                                        count));
+
+    #if OGLWRAP_DEBUG
+      OGLWRAP_PRINT_IF_ERROR(
+        ErrorType::kInvalidOperation,
+        "Error setting uniform value",
+        std::string{"UniformHandle::set is called for uniform '"} + name_ +
+        "' but either its program isn't in use, or the uniform template "
+        "parameter and the actual uniform type mismatches.");
+    #endif
+  }
+
+  /// Sets the uniform to value.
+  void operator=(const GLtype& value) const {
+    set(value);
+  }
 
-// -------======{[ UniformObject::set specializations ]}======-------
+  /// Gets the current value of the uniform.
+  /** @see glGetUniform* */
+  GLtype get() const {
+    GLtype val;
+    if (UniformCache::Get(program_, location_, &val, sizeof(GLtype))) {
+      return val;
+    }
+
+    val = glfunc(UniformObject<GLtype>::Download(program_, location_));
+
+    #if OGLWRAP_DEBUG
+      OGLWRAP_PRINT_IF_ERROR(
+        ErrorType::kInvalidOperation,
+        "Error getting uniform value",
+        std::string{"UniformHandle::get is called for uniform '"} + name_ +
+        "' but the uniform template parameter and the actual uniform "
+        "type mismatches.");
+    #endif
+
+    return val;
+  }
+
+  /// Gets the current value of the uniform.
+  operator GLtype() const {
+    return get();
+  }
+
+  /// Returns false if the uniform isn't active in the program.
+  bool valid() const {
+    return location_ != -1;
+  }
+
+  /// Returns the handle of the program.
+  GLuint program() const {
+    return program_;
+  }
+
+  /// Returns the location of the uniform.
+  GLint location() const {
+    return location_;
+  }
+
+ private:
+  GLuint program_;  // The C handle for the program.
+  GLint location_;  // The location of the uniform in the program.
+#if OGLWRAP_DEBUG
+  const char *name_;  // The uniform's name, for the error messages.
+#endif
+};
+
+
+// -------======{[ UniformObject::Upload specializations ]}======-------
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform1f)
 template<>
-inline void UniformObject<GLfloat>::set(const GLfloat& value, unsigned count) {
-  glUniform1fv(location_, count, &value);
+inline void UniformObject<GLfloat>::Upload(
+    GLint location, const GLfloat& value, unsigned count) {
+  glUniform1fv(location, count, &value);
 }
 #endif  // glUniform1f
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform1d)
 template<>
-inline void UniformObject<GLdouble>::set(const GLdouble& value, unsigned count) {
-  glUniform1dv(location_, count, &value);
+inline void UniformObject<GLdouble>::Upload(
+    GLint location, const GLdouble& value, unsigned count) {
+  glUniform1dv(location, count, &value);
 }
 #endif  // glUniform1d
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform1i)
 template<>
-inline void UniformObject<GLint>::set(const GLint& value, unsigned count) {
-  glUniform1iv(location_, count, &value);
+inline void UniformObject<GLint>::Upload(
+    GLint location, const GLint& value, unsigned count) {
+  glUniform1iv(location, count, &value);
 }
 #endif  // glUniform1i
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform1ui)
 template<>
-inline void UniformObject<GLuint>::set(const GLuint& value, unsigned count) {
-  glUniform1uiv(location_, count, &value);
+inline void UniformObject<GLuint>::Upload(
+    GLint location, const GLuint& value, unsigned count) {
+  glUniform1uiv(location, count, &value);
 }
 #endif  // glUniform1ui
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform2fv)
 template<>
-inline void UniformObject<glm::vec2>::set(const glm::vec2& vec, unsigned count) {
-  glUniform2fv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::vec2>::Upload(
+    GLint location, const glm::vec2& vec, unsigned count) {
+  glUniform2fv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform2fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform2dv)
 template<>
-inline void UniformObject<glm::dvec2>::set(const glm::dvec2& vec, unsigned count) {
-  glUniform2dv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::dvec2>::Upload(
+    GLint location, const glm::dvec2& vec, unsigned count) {
+  glUniform2dv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform2dv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform2iv)
 template<>
-inline void UniformObject<glm::ivec2>::set(const glm::ivec2& vec, unsigned count) {
-  glUniform2iv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::ivec2>::Upload(
+    GLint location, const glm::ivec2& vec, unsigned count) {
+  glUniform2iv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform2iv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform2uiv)
 template<>
-inline void UniformObject<glm::uvec2>::set(const glm::uvec2& vec, unsigned count) {
-  glUniform2uiv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::uvec2>::Upload(
+    GLint location, const glm::uvec2& vec, unsigned count) {
+  glUniform2uiv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform2uiv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform3fv)
 template<>
-inline void UniformObject<glm::vec3>::set(const glm::vec3& vec, unsigned count) {
-  glUniform3fv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::vec3>::Upload(
+    GLint location, const glm::vec3& vec, unsigned count) {
+  glUniform3fv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform3fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform3dv)
 template<>
-inline void UniformObject<glm::dvec3>::set(const glm::dvec3& vec, unsigned count) {
-  glUniform3dv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::dvec3>::Upload(
+    GLint location, const glm::dvec3& vec, unsigned count) {
+  glUniform3dv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform3dv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform3iv)
 template<>
-inline void UniformObject<glm::ivec3>::set(const glm::ivec3& vec, unsigned count) {
-  glUniform3iv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::ivec3>::Upload(
+    GLint location, const glm::ivec3& vec, unsigned count) {
+  glUniform3iv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform3iv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform3uiv)
 template<>
-inline void UniformObject<glm::uvec3>::set(const glm::uvec3& vec, unsigned count) {
-  glUniform3uiv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::uvec3>::Upload(
+    GLint location, const glm::uvec3& vec, unsigned count) {
+  glUniform3uiv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform3uiv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform4fv)
 template<>
-inline void UniformObject<glm::vec4>::set(const glm::vec4& vec, unsigned count) {
-  glUniform4fv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::vec4>::Upload(
+    GLint location, const glm::vec4& vec, unsigned count) {
+  glUniform4fv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform4fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform4dv)
 template<>
-inline void UniformObject<glm::dvec4>::set(const glm::dvec4& vec, unsigned count) {
-  glUniform4dv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::dvec4>::Upload(
+    GLint location, const glm::dvec4& vec, unsigned count) {
+  glUniform4dv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform4dv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform4iv)
 template<>
-inline void UniformObject<glm::ivec4>::set(const glm::ivec4& vec, unsigned count) {
-  glUniform4iv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::ivec4>::Upload(
+    GLint location, const glm::ivec4& vec, unsigned count) {
+  glUniform4iv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform4iv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniform4uiv)
 template<>
-inline void UniformObject<glm::uvec4>::set(const glm::uvec4& vec, unsigned count) {
-  glUniform4uiv(location_, count, glm::value_ptr(vec));
+inline void UniformObject<glm::uvec4>::Upload(
+    GLint location, const glm::uvec4& vec, unsigned count) {
+  glUniform4uiv(location, count, glm::value_ptr(vec));
 }
 #endif  // glUniform4uiv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix2fv)
 template<>
-inline void UniformObject<glm::mat2>::set(const glm::mat2& mat, unsigned count) {
-  glUniformMatrix2fv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::mat2>::Upload(
+    GLint location, const glm::mat2& mat, unsigned count) {
+  glUniformMatrix2fv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix2fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix2dv)
 template<>
-inline void UniformObject<glm::dmat2>::set(const glm::dmat2& mat, unsigned count) {
-  glUniformMatrix2dv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::dmat2>::Upload(
+    GLint location, const glm::dmat2& mat, unsigned count) {
+  glUniformMatrix2dv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix2dv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix3fv)
 template<>
-inline void UniformObject<glm::mat3>::set(const glm::mat3& mat, unsigned count) {
-  glUniformMatrix3fv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::mat3>::Upload(
+    GLint location, const glm::mat3& mat, unsigned count) {
+  glUniformMatrix3fv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix3fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix3dv)
 template<>
-inline void UniformObject<glm::dmat3>::set(const glm::dmat3& mat, unsigned count) {
-  glUniformMatrix3dv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::dmat3>::Upload(
+    GLint location, const glm::dmat3& mat, unsigned count) {
+  glUniformMatrix3dv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix3dv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix4fv)
 template<>
-inline void UniformObject<glm::mat4>::set(const glm::mat4& mat, unsigned count) {
-  glUniformMatrix4fv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::mat4>::Upload(
+    GLint location, const glm::mat4& mat, unsigned count) {
+  glUniformMatrix4fv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix4fv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glUniformMatrix4dv)
 template<>
-inline void UniformObject<glm::dmat4>::set(const glm::dmat4& mat, unsigned count) {
-  glUniformMatrix4dv(location_, count, GL_FALSE, glm::value_ptr(mat));
+inline void UniformObject<glm::dmat4>::Upload(
+    GLint location, const glm::dmat4& mat, unsigned count) {
+  glUniformMatrix4dv(location, count, GL_FALSE, glm::value_ptr(mat));
 }
 #endif  // glUniformMatrix4dv
 
-// -------======{[ UniformObject::get specializations ]}======-------
+// -------======{[ UniformObject::ProgramUpload specializations ]}======-------
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform1f)
+template<>
+inline void UniformObject<GLfloat>::ProgramUpload(
+    GLuint program, GLint location, const GLfloat& value, unsigned count) {
+  glProgramUniform1fv(program, location, count, &value);
+}
+#endif  // glProgramUniform1f
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform1d)
+template<>
+inline void UniformObject<GLdouble>::ProgramUpload(
+    GLuint program, GLint location, const GLdouble& value, unsigned count) {
+  glProgramUniform1dv(program, location, count, &value);
+}
+#endif  // glProgramUniform1d
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform1i)
+template<>
+inline void UniformObject<GLint>::ProgramUpload(
+    GLuint program, GLint location, const GLint& value, unsigned count) {
+  glProgramUniform1iv(program, location, count, &value);
+}
+#endif  // glProgramUniform1i
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform1ui)
+template<>
+inline void UniformObject<GLuint>::ProgramUpload(
+    GLuint program, GLint location, const GLuint& value, unsigned count) {
+  glProgramUniform1uiv(program, location, count, &value);
+}
+#endif  // glProgramUniform1ui
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform2fv)
+template<>
+inline void UniformObject<glm::vec2>::ProgramUpload(
+    GLuint program, GLint location, const glm::vec2& vec, unsigned count) {
+  glProgramUniform2fv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform2fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform2dv)
+template<>
+inline void UniformObject<glm::dvec2>::ProgramUpload(
+    GLuint program, GLint location, const glm::dvec2& vec, unsigned count) {
+  glProgramUniform2dv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform2dv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform2iv)
+template<>
+inline void UniformObject<glm::ivec2>::ProgramUpload(
+    GLuint program, GLint location, const glm::ivec2& vec, unsigned count) {
+  glProgramUniform2iv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform2iv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform2uiv)
+template<>
+inline void UniformObject<glm::uvec2>::ProgramUpload(
+    GLuint program, GLint location, const glm::uvec2& vec, unsigned count) {
+  glProgramUniform2uiv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform2uiv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform3fv)
+template<>
+inline void UniformObject<glm::vec3>::ProgramUpload(
+    GLuint program, GLint location, const glm::vec3& vec, unsigned count) {
+  glProgramUniform3fv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform3fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform3dv)
+template<>
+inline void UniformObject<glm::dvec3>::ProgramUpload(
+    GLuint program, GLint location, const glm::dvec3& vec, unsigned count) {
+  glProgramUniform3dv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform3dv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform3iv)
+template<>
+inline void UniformObject<glm::ivec3>::ProgramUpload(
+    GLuint program, GLint location, const glm::ivec3& vec, unsigned count) {
+  glProgramUniform3iv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform3iv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform3uiv)
+template<>
+inline void UniformObject<glm::uvec3>::ProgramUpload(
+    GLuint program, GLint location, const glm::uvec3& vec, unsigned count) {
+  glProgramUniform3uiv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform3uiv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform4fv)
+template<>
+inline void UniformObject<glm::vec4>::ProgramUpload(
+    GLuint program, GLint location, const glm::vec4& vec, unsigned count) {
+  glProgramUniform4fv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform4fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform4dv)
+template<>
+inline void UniformObject<glm::dvec4>::ProgramUpload(
+    GLuint program, GLint location, const glm::dvec4& vec, unsigned count) {
+  glProgramUniform4dv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform4dv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform4iv)
+template<>
+inline void UniformObject<glm::ivec4>::ProgramUpload(
+    GLuint program, GLint location, const glm::ivec4& vec, unsigned count) {
+  glProgramUniform4iv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform4iv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniform4uiv)
+template<>
+inline void UniformObject<glm::uvec4>::ProgramUpload(
+    GLuint program, GLint location, const glm::uvec4& vec, unsigned count) {
+  glProgramUniform4uiv(program, location, count, glm::value_ptr(vec));
+}
+#endif  // glProgramUniform4uiv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix2fv)
+template<>
+inline void UniformObject<glm::mat2>::ProgramUpload(
+    GLuint program, GLint location, const glm::mat2& mat, unsigned count) {
+  glProgramUniformMatrix2fv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix2fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix2dv)
+template<>
+inline void UniformObject<glm::dmat2>::ProgramUpload(
+    GLuint program, GLint location, const glm::dmat2& mat, unsigned count) {
+  glProgramUniformMatrix2dv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix2dv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix3fv)
+template<>
+inline void UniformObject<glm::mat3>::ProgramUpload(
+    GLuint program, GLint location, const glm::mat3& mat, unsigned count) {
+  glProgramUniformMatrix3fv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix3fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix3dv)
+template<>
+inline void UniformObject<glm::dmat3>::ProgramUpload(
+    GLuint program, GLint location, const glm::dmat3& mat, unsigned count) {
+  glProgramUniformMatrix3dv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix3dv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix4fv)
+template<>
+inline void UniformObject<glm::mat4>::ProgramUpload(
+    GLuint program, GLint location, const glm::mat4& mat, unsigned count) {
+  glProgramUniformMatrix4fv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix4fv
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(glProgramUniformMatrix4dv)
+template<>
+inline void UniformObject<glm::dmat4>::ProgramUpload(
+    GLuint program, GLint location, const glm::dmat4& mat, unsigned count) {
+  glProgramUniformMatrix4dv(program, location, count, GL_FALSE,
+                            glm::value_ptr(mat));
+}
+#endif  // glProgramUniformMatrix4dv
+
+// -------======{[ UniformObject::Download specializations ]}======-------
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetUniformfv)
 template<>
-inline GLfloat UniformObject<GLfloat>::get() const {
+inline GLfloat UniformObject<GLfloat>::Download(
+    GLuint program, GLint location) {
   GLfloat value;
-  glGetUniformfv(program_.expose(), location_, &value);
+  glGetUniformfv(program, location, &value);
   return value;
 }
 
 template<>
-inline glm::vec2 UniformObject<glm::vec2>::get() const {
+inline glm::vec2 UniformObject<glm::vec2>::Download(
+    GLuint program, GLint location) {
   glm::vec2 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::vec3 UniformObject<glm::vec3>::get() const {
+inline glm::vec3 UniformObject<glm::vec3>::Download(
+    GLuint program, GLint location) {
   glm::vec3 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::vec4 UniformObject<glm::vec4>::get() const {
+inline glm::vec4 UniformObject<glm::vec4>::Download(
+    GLuint program, GLint location) {
   glm::vec4 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::mat2 UniformObject<glm::mat2>::get() const {
+inline glm::mat2 UniformObject<glm::mat2>::Download(
+    GLuint program, GLint location) {
   glm::mat2 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::mat3 UniformObject<glm::mat3>::get() const {
+inline glm::mat3 UniformObject<glm::mat3>::Download(
+    GLuint program, GLint location) {
   glm::mat3 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::mat4 UniformObject<glm::mat4>::get() const {
+inline glm::mat4 UniformObject<glm::mat4>::Download(
+    GLuint program, GLint location) {
   glm::mat4 value;
-  glGetUniformfv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformfv(program, location, glm::value_ptr(value));
   return value;
 }
 #endif  // glGetUniformfv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetUniformdv)
 template<>
-inline GLdouble UniformObject<GLdouble>::get() const {
+inline GLdouble UniformObject<GLdouble>::Download(
+    GLuint program, GLint location) {
   GLdouble value;
-  glGetUniformdv(program_.expose(), location_, &value);
+  glGetUniformdv(program, location, &value);
   return value;
 }
 
 template<>
-inline glm::dvec2 UniformObject<glm::dvec2>::get() const {
+inline glm::dvec2 UniformObject<glm::dvec2>::Download(
+    GLuint program, GLint location) {
   glm::dvec2 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::dvec3 UniformObject<glm::dvec3>::get() const {
+inline glm::dvec3 UniformObject<glm::dvec3>::Download(
+    GLuint program, GLint location) {
   glm::dvec3 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::dvec4 UniformObject<glm::dvec4>::get() const {
+inline glm::dvec4 UniformObject<glm::dvec4>::Download(
+    GLuint program, GLint location) {
   glm::dvec4 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::dmat2 UniformObject<glm::dmat2>::get() const {
+inline glm::dmat2 UniformObject<glm::dmat2>::Download(
+    GLuint program, GLint location) {
   glm::dmat2 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::dmat3 UniformObject<glm::dmat3>::get() const {
+inline glm::dmat3 UniformObject<glm::dmat3>::Download(
+    GLuint program, GLint location) {
   glm::dmat3 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::dmat4 UniformObject<glm::dmat4>::get() const {
+inline glm::dmat4 UniformObject<glm::dmat4>::Download(
+    GLuint program, GLint location) {
   glm::dmat4 value;
-  glGetUniformdv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformdv(program, location, glm::value_ptr(value));
   return value;
 }
 #endif  // glGetUniformdv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetUniformiv)
 template<>
-inline GLint UniformObject<GLint>::get() const {
+inline GLint UniformObject<GLint>::Download(
+    GLuint program, GLint location) {
   GLint value;
-  glGetUniformiv(program_.expose(), location_, &value);
+  glGetUniformiv(program, location, &value);
   return value;
 }
 
 template<>
-inline glm::ivec2 UniformObject<glm::ivec2>::get() const {
+inline glm::ivec2 UniformObject<glm::ivec2>::Download(
+    GLuint program, GLint location) {
   glm::ivec2 value;
-  glGetUniformiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformiv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::ivec3 UniformObject<glm::ivec3>::get() const {
+inline glm::ivec3 UniformObject<glm::ivec3>::Download(
+    GLuint program, GLint location) {
   glm::ivec3 value;
-  glGetUniformiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformiv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::ivec4 UniformObject<glm::ivec4>::get() const {
+inline glm::ivec4 UniformObject<glm::ivec4>::Download(
+    GLuint program, GLint location) {
   glm::ivec4 value;
-  glGetUniformiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformiv(program, location, glm::value_ptr(value));
   return value;
 }
 #endif  // glGetUniformiv
 
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glGetUniformuiv)
 template<>
-inline GLuint UniformObject<GLuint>::get() const {
+inline GLuint UniformObject<GLuint>::Download(
+    GLuint program, GLint location) {
   GLuint value;
-  glGetUniformuiv(program_.expose(), location_, &value);
+  glGetUniformuiv(program, location, &value);
   return value;
 }
 
 template<>
-inline glm::uvec2 UniformObject<glm::uvec2>::get() const {
+inline glm::uvec2 UniformObject<glm::uvec2>::Download(
+    GLuint program, GLint location) {
   glm::uvec2 value;
-  glGetUniformuiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformuiv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::uvec3 UniformObject<glm::uvec3>::get() const {
+inline glm::uvec3 UniformObject<glm::uvec3>::Download(
+    GLuint program, GLint location) {
   glm::uvec3 value;
-  glGetUniformuiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformuiv(program, location, glm::value_ptr(value));
   return value;
 }
 
 template<>
-inline glm::uvec4 UniformObject<glm::uvec4>::get() const {
+inline glm::uvec4 UniformObject<glm::uvec4>::Download(
+    GLuint program, GLint location) {
   glm::uvec4 value;
-  glGetUniformuiv(program_.expose(), location_, glm::value_ptr(value));
+  glGetUniformuiv(program, location, glm::value_ptr(value));
   return value;
 }
 #endif  // glGetUniformuiv
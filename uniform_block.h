@@ -0,0 +1,407 @@
+// Copyright (c) Tamas Csala
+
+/** @file uniform_block.h
+    @brief Implements uniform and shader storage blocks with a compile time
+           std140 / std430 layout.
+*/
+
+#ifndef OGLWRAP_UNIFORM_BLOCK_H_
+#define OGLWRAP_UNIFORM_BLOCK_H_
+
+#include <cstddef>
+#include <cstring>
+
+#include "./config.h"
+#include "./buffer.h"
+#include "context/binding.h"
+
+#define GLM_FORCE_RADIANS
+#include <glm/glm.hpp>
+
+#include "./define_internal_macros.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+/// The memory layouts of the interface blocks.
+enum class BlockLayout {
+  /// The layout of the uniform blocks (arrays and matrix columns are aligned
+  /// to 16 bytes).
+  kStd140,
+  /// The layout of the shader storage blocks (like std140, but arrays of
+  /// scalars and two component vectors are tightly packed).
+  kStd430
+};
+
+// -------======{[ Layout rules ]}======-------
+
+/// Rounds value up to a multiple of alignment.
+constexpr size_t OGLWRAP_BlockRoundUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+constexpr size_t OGLWRAP_BlockMax(size_t a, size_t b) {
+  return a < b ? b : a;
+}
+
+template<typename T>
+/// Describes how a C++ type maps to a GLSL type in a block.
+/** Specialized for the scalar, vector and matrix types the Uniforms accept. */
+struct BlockMemberType {
+  static_assert((sizeof(T), false),
+      "Trying to use a type in a block that is not an OpenGL type.");
+};
+
+#define OGLWRAP_BLOCK_MEMBER_TYPE(T, C, COLUMNS, ROWS) \
+  template<> \
+  struct BlockMemberType<T> { \
+    typedef C Component; \
+    enum : size_t { kColumns = COLUMNS, kRows = ROWS }; \
+  };
+
+OGLWRAP_BLOCK_MEMBER_TYPE(GLfloat, GLfloat, 1, 1)
+OGLWRAP_BLOCK_MEMBER_TYPE(GLdouble, GLdouble, 1, 1)
+OGLWRAP_BLOCK_MEMBER_TYPE(GLint, GLint, 1, 1)
+OGLWRAP_BLOCK_MEMBER_TYPE(GLuint, GLuint, 1, 1)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::vec2, GLfloat, 1, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dvec2, GLdouble, 1, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::ivec2, GLint, 1, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::uvec2, GLuint, 1, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::vec3, GLfloat, 1, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dvec3, GLdouble, 1, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::ivec3, GLint, 1, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::uvec3, GLuint, 1, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::vec4, GLfloat, 1, 4)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dvec4, GLdouble, 1, 4)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::ivec4, GLint, 1, 4)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::uvec4, GLuint, 1, 4)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::mat2, GLfloat, 2, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dmat2, GLdouble, 2, 2)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::mat3, GLfloat, 3, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dmat3, GLdouble, 3, 3)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::mat4, GLfloat, 4, 4)
+OGLWRAP_BLOCK_MEMBER_TYPE(glm::dmat4, GLdouble, 4, 4)
+
+#undef OGLWRAP_BLOCK_MEMBER_TYPE
+
+template<BlockLayout LAYOUT, typename T>
+/// The size, alignment and strides of a block member.
+/** Matrices are stored as arrays of column vectors (column major). The client
+  * side values are tightly packed (like glm types are), the strides can only
+  * be larger in the block. */
+struct BlockMemberLayout {
+  typedef T Type;
+  typedef BlockMemberType<T> MemberType;
+
+  enum : size_t {
+    /// The number of bytes copied for a column.
+    kColumnSize = MemberType::kRows * sizeof(typename MemberType::Component),
+
+    /// The base alignment of a column (a three component vector is aligned
+    /// like a four component one).
+    kColumnAlignment = (size_t(MemberType::kRows) == 3
+                        ? size_t(4) : size_t(MemberType::kRows)) *
+                       sizeof(typename MemberType::Component),
+
+    /// The alignment of a matrix or an array element.
+    kArrayAlignment = LAYOUT == BlockLayout::kStd140
+        ? OGLWRAP_BlockRoundUp(kColumnAlignment, 16) : kColumnAlignment,
+
+    kColumns = MemberType::kColumns,
+    kColumnStride = kColumns == 1
+        ? kColumnSize : OGLWRAP_BlockRoundUp(kColumnSize, kArrayAlignment),
+
+    kCount = 1,
+    kAlignment = kColumns == 1 ? kColumnAlignment : kArrayAlignment,
+    kSize = kColumns * kColumnStride,
+    kElementStride = kSize
+  };
+};
+
+template<BlockLayout LAYOUT, typename T, size_t N>
+/// The size, alignment and strides of an array block member.
+struct BlockMemberLayout<LAYOUT, T[N]> {
+  typedef T Type;
+  typedef BlockMemberLayout<LAYOUT, T> Element;
+
+  enum : size_t {
+    kColumnSize = Element::kColumnSize,
+    kColumns = Element::kColumns,
+    kColumnStride = Element::kColumnStride,
+    kCount = N,
+    kAlignment = Element::kArrayAlignment,
+    kElementStride = OGLWRAP_BlockRoundUp(Element::kSize, kAlignment),
+    kSize = N * kElementStride
+  };
+};
+
+template<BlockLayout LAYOUT, typename T>
+/// Copies a client side value into its place in a block.
+/** @param value - The value (or array).
+  * @param dst - The address of the member in the block. */
+inline void OGLWRAP_PackBlockMember(const T* value, unsigned char *dst) {
+  typedef BlockMemberLayout<LAYOUT, T> Layout;
+  const unsigned char *src = reinterpret_cast<const unsigned char*>(value);
+  if (Layout::kElementStride == sizeof(typename Layout::Type) &&
+      Layout::kColumnStride == Layout::kColumnSize) {
+    std::memcpy(dst, src, Layout::kSize);
+    return;
+  }
+  for (size_t i = 0; i < Layout::kCount; ++i) {
+    for (size_t c = 0; c < Layout::kColumns; ++c) {
+      std::memcpy(dst + i * Layout::kElementStride + c * Layout::kColumnStride,
+                  src + i * sizeof(typename Layout::Type) +
+                  c * Layout::kColumnSize,
+                  Layout::kColumnSize);
+    }
+  }
+}
+
+// -------======{[ Field description ]}======-------
+
+template<typename Struct, typename T, T Struct::*kMember>
+/// A member of a struct, that is stored in a block.
+/** Use OGLWRAP_BLOCK_FIELD to spell it. */
+struct BlockField {
+  typedef T Type;
+
+  static const T& Get(const Struct& value) {
+    return value.*kMember;
+  }
+};
+
+/// Describes a BlockField for a member of a struct.
+#define OGLWRAP_BLOCK_FIELD(Struct, member) \
+  OGLWRAP_NAMESPACE_NAME::BlockField< \
+      Struct, decltype(Struct::member), &Struct::member>
+
+template<typename... Fields>
+/// The list of the members of a struct, in the order they are declared in the
+/// GLSL block.
+/** A struct used by a UniformBlock or a StorageBlock has to describe its
+  * members with a nested Fields typedef:
+  * @code
+  *   struct Material {
+  *     glm::vec4 color;
+  *     GLfloat roughness;
+  *     glm::vec3 lights[4];
+  *     glm::mat3 normal_matrix;
+  *
+  *     typedef gl::BlockFields<
+  *       OGLWRAP_BLOCK_FIELD(Material, color),
+  *       OGLWRAP_BLOCK_FIELD(Material, roughness),
+  *       OGLWRAP_BLOCK_FIELD(Material, lights),
+  *       OGLWRAP_BLOCK_FIELD(Material, normal_matrix)
+  *     > Fields;
+  *   };
+  * @endcode */
+struct BlockFields {};
+
+template<BlockLayout LAYOUT, size_t kStart, typename... Fields>
+/// Computes the offsets of a list of fields, starting at kStart.
+struct OGLWRAP_BlockFieldsLayout;
+
+template<BlockLayout LAYOUT, size_t kStart>
+struct OGLWRAP_BlockFieldsLayout<LAYOUT, kStart> {
+  enum : size_t {
+    kEnd = kStart,
+    // The size of a std140 block is rounded up to the alignment of a vec4.
+    kAlignment = LAYOUT == BlockLayout::kStd140 ? 16 : 1
+  };
+
+  template<typename Struct>
+  static void Pack(const Struct&, unsigned char*) { }
+};
+
+template<BlockLayout LAYOUT, size_t kStart, typename Field, typename... Rest>
+struct OGLWRAP_BlockFieldsLayout<LAYOUT, kStart, Field, Rest...> {
+  typedef BlockMemberLayout<LAYOUT, typename Field::Type> Member;
+
+  enum : size_t {
+    kOffset = OGLWRAP_BlockRoundUp(kStart, Member::kAlignment)
+  };
+
+  typedef OGLWRAP_BlockFieldsLayout<
+      LAYOUT, kOffset + Member::kSize, Rest...> Next;
+
+  enum : size_t {
+    kEnd = Next::kEnd,
+    kAlignment = OGLWRAP_BlockMax(Member::kAlignment, Next::kAlignment)
+  };
+
+  template<typename Struct>
+  static void Pack(const Struct& value, unsigned char *dst) {
+    OGLWRAP_PackBlockMember<LAYOUT, typename Field::Type>(
+        &Field::Get(value), dst + kOffset);
+    Next::Pack(value, dst);
+  }
+};
+
+template<size_t I, typename FieldsLayout>
+struct OGLWRAP_BlockFieldAt {
+  typedef typename OGLWRAP_BlockFieldAt<
+      I - 1, typename FieldsLayout::Next>::Type Type;
+};
+
+template<typename FieldsLayout>
+struct OGLWRAP_BlockFieldAt<0, FieldsLayout> {
+  typedef FieldsLayout Type;
+};
+
+template<BlockLayout LAYOUT, typename Fields>
+/// The layout of a block described by a BlockFields list.
+struct BlockStructLayout;
+
+template<BlockLayout LAYOUT, typename... Fields>
+struct BlockStructLayout<LAYOUT, BlockFields<Fields...>> {
+  typedef OGLWRAP_BlockFieldsLayout<LAYOUT, 0, Fields...> FieldsLayout;
+
+  enum : size_t {
+    /// The size of the block's data in bytes (GL_BUFFER_DATA_SIZE).
+    kSize = OGLWRAP_BlockRoundUp(FieldsLayout::kEnd, FieldsLayout::kAlignment)
+  };
+
+  /// Returns the offset of the Ith field in bytes (GL_OFFSET).
+  template<size_t I>
+  static constexpr size_t Offset() {
+    return OGLWRAP_BlockFieldAt<I, FieldsLayout>::Type::kOffset;
+  }
+
+  /// Copies the fields of value into their places in dst (of kSize bytes).
+  template<typename Struct>
+  static void Pack(const Struct& value, unsigned char *dst) {
+    FieldsLayout::Pack(value, dst);
+  }
+};
+
+// -------======{[ BufferBlock ]}======-------
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glBindBufferBase) && \
+    defined(glBufferData) && defined(glBufferSubData))
+template<typename Struct, IndexedBufferType BUFFER_TYPE, GLuint index,
+         BlockLayout LAYOUT>
+/// A buffer that stores the value of a Struct for an interface block.
+/** The client side value is a plain struct (with members like glm::vec3, or
+  * arrays of them), that describes its members with a nested Fields typedef
+  * (see BlockFields). Its members are packed into the block's layout, with the
+  * offsets computed at compile time, so setting the whole block doesn't need
+  * any per member gl calls.
+  *
+  * update() packs the value, and uploads only the range of bytes that changed
+  * since the previous update (with a single glBufferSubData), or nothing if
+  * the value didn't change.
+  * @see UniformBlock, StorageBlock */
+class BufferBlock {
+ public:
+  /// The layout of the Struct in the block.
+  typedef BlockStructLayout<LAYOUT, typename Struct::Fields> Layout;
+
+  /// Creates the buffer, and uploads the initial value.
+  /** @param value - The initial value of the block.
+    * @param usage - The expected usage pattern of the buffer.
+    * @see glBufferData */
+  explicit BufferBlock(const Struct& value = Struct{},
+                       BufferUsage usage = BufferUsage::kDynamicDraw)
+      : value_(value) {
+    std::memset(uploaded_, 0, sizeof(uploaded_));
+    Layout::Pack(value_, uploaded_);
+  #if OGLWRAP_USE_DSA
+    buffer_.data(Layout::kSize, uploaded_, usage);
+  #else
+    TemporaryBind<BufferObject<BufferType(BUFFER_TYPE)>> bind{buffer_};
+    buffer_.data(Layout::kSize, uploaded_, usage);
+  #endif
+  }
+
+  /// Returns the client side value. The changes are uploaded by update().
+  Struct& value() { return value_; }
+
+  /// Returns the client side value.
+  const Struct& value() const { return value_; }
+
+  /// Sets the client side value. The changes are uploaded by update().
+  void set(const Struct& value) { value_ = value; }
+
+  /// Sets the client side value, and uploads it.
+  BufferBlock& operator=(const Struct& value) {
+    set(value);
+    update();
+    return *this;
+  }
+
+  /// Uploads the range of the block that changed since the last update.
+  /** @return The number of bytes uploaded.
+    * @see glBufferSubData */
+  size_t update() {
+    unsigned char packed[Layout::kSize];
+    std::memcpy(packed, uploaded_, sizeof(packed));
+    Layout::Pack(value_, packed);
+
+    size_t begin = 0, end = Layout::kSize;
+    while (begin < end && packed[begin] == uploaded_[begin]) {
+      ++begin;
+    }
+    if (begin == end) {
+      return 0;
+    }
+    while (packed[end - 1] == uploaded_[end - 1]) {
+      --end;
+    }
+    // Upload whole components.
+    begin = begin / 4 * 4;
+    end = OGLWRAP_BlockRoundUp(end, 4);
+
+  #if OGLWRAP_USE_DSA
+    buffer_.subData(begin, end - begin, packed + begin);
+  #else
+    TemporaryBind<BufferObject<BufferType(BUFFER_TYPE)>> bind{buffer_};
+    buffer_.subData(begin, end - begin, packed + begin);
+  #endif
+    std::memcpy(uploaded_ + begin, packed + begin, end - begin);
+    return end - begin;
+  }
+
+  /// Binds the buffer to its indexed binding point.
+  /** @see glBindBufferBase */
+  void bind() const {
+    Bind(buffer_);
+  }
+
+  /// Returns the underlying buffer object.
+  const IndexedBufferObject<BUFFER_TYPE, index>& buffer() const {
+    return buffer_;
+  }
+
+  /// Returns the handle for the buffer.
+  const glObject& expose() const { return buffer_.expose(); }
+
+ private:
+  IndexedBufferObject<BUFFER_TYPE, index> buffer_;
+  Struct value_;
+
+  /// The packed value, as it is in the buffer.
+  unsigned char uploaded_[Layout::kSize];
+};
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_UNIFORM_BUFFER)
+/// A std140 uniform block, stored in the UniformBuffer<index>.
+template<typename Struct, GLuint index = 0>
+using UniformBlock = BufferBlock<Struct, IndexedBufferType::kUniformBuffer,
+                                 index, BlockLayout::kStd140>;
+#endif  // GL_UNIFORM_BUFFER
+
+#if OGLWRAP_DEFINE_EVERYTHING || defined(GL_SHADER_STORAGE_BUFFER)
+/// A std430 shader storage block, stored in the shader storage buffer at
+/// index.
+template<typename Struct, GLuint index = 0>
+using StorageBlock = BufferBlock<Struct,
+                                 IndexedBufferType::kShaderStorageBuffer,
+                                 index, BlockLayout::kStd430>;
+#endif  // GL_SHADER_STORAGE_BUFFER
+
+#endif  // glBindBufferBase && glBufferData && glBufferSubData
+
+}  // namespace oglwrap
+
+#include "./undefine_internal_macros.h"
+
+#endif  // OGLWRAP_UNIFORM_BLOCK_H_
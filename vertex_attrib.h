@@ -122,7 +122,7 @@ class VertexAttribObject {
         break;
       case DataType::kDouble:
 #if OGLWRAP_DEFINE_EVERYTHING || defined(glVertexAttribLPointer)
-        lpointer(values_per_vertex, stride, nullptr);
+        lpointer(values_per_vertex, stride, offset_pointer);
 #else
         throw std::runtime_error("VertexAttribObject::setup() is called with "
           "DataType::double, but the glVertexAttribLPointer symbol is missing.");
@@ -428,7 +428,7 @@ class VertexAttrib : public VertexAttribObject {
    * @see glGetAttribLocation
    */
   VertexAttrib(const Program& program, const std::string& identifier) {
-    location_ = gl(GetAttribLocation(program.expose(), identifier.c_str()));
+    location_ = program.attribLocation(identifier.c_str());
     if (location_ == this->kInvalidLocation) {
       OGLWRAP_PRINT_ERROR("Error getting attribute location",
         "Unable to get location of attribute '" + identifier + "'");
@@ -496,7 +496,7 @@ class LazyVertexAttrib : public VertexAttribObject {
   virtual void init() override {
     OGLWRAP_CHECK_BINDING_EXPLICIT(program_);
 
-    location_ = gl(GetAttribLocation(program_.expose(), identifier_.c_str()));
+    location_ = program_.attribLocation(identifier_.c_str());
     if (location_ == this->kInvalidLocation) {
       OGLWRAP_PRINT_ERROR("Error getting attribute location",
           "Unable to get location of attribute '" + identifier_ + "'");
@@ -0,0 +1,249 @@
+// Copyright (c) Tamas Csala
+
+/** @file vertex_layout.h
+    @brief Implements the compile time description of interleaved vertices.
+*/
+
+#ifndef OGLWRAP_VERTEX_LAYOUT_H_
+#define OGLWRAP_VERTEX_LAYOUT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "./config.h"
+#include "./hash.h"
+#include "./vertex_attrib.h"
+#include "enums/data_type.h"
+
+namespace OGLWRAP_NAMESPACE_NAME {
+
+// -------======{[ Attribute formats ]}======-------
+
+template<typename T>
+/// The number and the type of the components of a vertex attribute (a glm
+/// vector, or a scalar).
+struct VertexAttribFormat {
+  typedef typename T::value_type Component;
+
+  enum : GLuint {
+    kComponents = sizeof(T) / sizeof(Component)
+  };
+
+  static constexpr GLenum Type() {
+    return VertexAttribFormat<Component>::Type();
+  }
+
+  static_assert(VertexAttribFormat<Component>::kComponents == 1 &&
+                kComponents <= 4,
+                "A vertex attribute can have at most 4 scalar components");
+};
+
+#define OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLtype, data_type) \
+  template<> \
+  struct VertexAttribFormat<GLtype> { \
+    typedef GLtype Component; \
+    enum : GLuint { kComponents = 1 }; \
+    static constexpr GLenum Type() { return GLenum(data_type); } \
+  };
+
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLbyte, DataType::kByte)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLubyte, DataType::kUnsignedByte)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLshort, DataType::kShort)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLushort, DataType::kUnsignedShort)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLint, DataType::kInt)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLuint, DataType::kUnsignedInt)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLfloat, DataType::kFloat)
+OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT(GLdouble, DataType::kDouble)
+
+#undef OGLWRAP_VERTEX_ATTRIB_SCALAR_FORMAT
+
+// -------======{[ Field description ]}======-------
+
+template<typename Struct, typename T, T Struct::*kMember, GLuint kLocationValue,
+         bool kNormalizedValue>
+/// A member of a vertex struct, that is read by a vertex attribute.
+/** Use OGLWRAP_VERTEX_FIELD or OGLWRAP_VERTEX_FIELD_NORMALIZED to spell it. */
+struct VertexField {
+  typedef T Type;
+  typedef VertexAttribFormat<T> Format;
+
+  static constexpr GLuint kLocation = kLocationValue;
+  static constexpr bool kNormalized = kNormalizedValue;
+
+  static_assert(!kNormalized || (Format::Type() != GL_FLOAT &&
+                                 Format::Type() != GL_DOUBLE),
+                "Only integer vertex attributes can be normalized");
+
+  /// Returns the offset of the member in the struct in bytes.
+  /** offsetof can't be used in the struct's own VertexAttribs typedef (the
+    * struct is incomplete there), so the offset is computed from the member
+    * pointer, once, on the first call (from VertexLayout, where the struct is
+    * already complete). Like offsetof, it requires a standard-layout struct. */
+  static size_t Offset() {
+    static_assert(std::is_standard_layout<Struct>::value,
+                  "The struct of a VertexLayout has to be standard-layout");
+    static const size_t offset = ComputeOffset();
+    return offset;
+  }
+
+ private:
+  static size_t ComputeOffset() {
+    typename std::aligned_storage<sizeof(Struct), alignof(Struct)>::type
+        storage;
+    const Struct *value = reinterpret_cast<const Struct*>(&storage);
+    return reinterpret_cast<const unsigned char*>(&(value->*kMember)) -
+           reinterpret_cast<const unsigned char*>(value);
+  }
+};
+
+/// Describes a VertexField for a member of a struct, that is read by the
+/// attribute at location (integers stay integers, see
+/// VertexAttribObject::setup).
+#define OGLWRAP_VERTEX_FIELD(Struct, member, location) \
+  OGLWRAP_NAMESPACE_NAME::VertexField< \
+      Struct, decltype(Struct::member), &Struct::member, location, false>
+
+/// Describes a VertexField for an integer member of a struct, that is read as
+/// a float normalized to [0, 1] (or [-1, 1] for signed types), by the
+/// attribute at location.
+#define OGLWRAP_VERTEX_FIELD_NORMALIZED(Struct, member, location) \
+  OGLWRAP_NAMESPACE_NAME::VertexField< \
+      Struct, decltype(Struct::member), &Struct::member, location, true>
+
+template<typename... Fields>
+/// The list of the members of a vertex struct, that are vertex attributes.
+/** A struct used by a VertexLayout has to be standard-layout, and it has to
+  * describe its members with a nested VertexAttribs typedef:
+  * @code
+  *   struct Vertex {
+  *     glm::vec3 position;
+  *     glm::vec2 tex_coord;
+  *     glm::u8vec4 color;
+  *
+  *     typedef gl::VertexFields<
+  *       OGLWRAP_VERTEX_FIELD(Vertex, position, 0),
+  *       OGLWRAP_VERTEX_FIELD(Vertex, tex_coord, 1),
+  *       OGLWRAP_VERTEX_FIELD_NORMALIZED(Vertex, color, 2)
+  *     > VertexAttribs;
+  *   };
+  * @endcode */
+struct VertexFields {};
+
+#if OGLWRAP_DEFINE_EVERYTHING || (defined(glGetAttribLocation) && \
+    defined(glVertexAttribPointer) && defined(glVertexAttribIPointer) && \
+    defined(glEnableVertexAttribArray))
+template<typename... Fields>
+/// Sets up, and hashes a list of fields.
+struct OGLWRAP_VertexFieldList;
+
+template<>
+struct OGLWRAP_VertexFieldList<> {
+  enum : size_t { kCount = 0 };
+
+  static void Apply(GLsizei, std::uintptr_t) { }
+
+  static std::uint64_t Hash(std::uint64_t hash) {
+    return hash;
+  }
+};
+
+template<typename Field, typename... Rest>
+struct OGLWRAP_VertexFieldList<Field, Rest...> {
+  typedef OGLWRAP_VertexFieldList<Rest...> Next;
+
+  enum : size_t { kCount = 1 + Next::kCount };
+
+  static void Apply(GLsizei stride, std::uintptr_t base_offset) {
+    VertexAttribObject attrib(Field::kLocation);
+    SetPointer(attrib, stride,
+               reinterpret_cast<const void*>(base_offset + Field::Offset()),
+               std::integral_constant<bool, Field::kNormalized>());
+    attrib.enable();
+    Next::Apply(stride, base_offset);
+  }
+
+  static std::uint64_t Hash(std::uint64_t hash) {
+    hash = OGLWRAP_HashValue(hash, Field::kLocation);
+    hash = OGLWRAP_HashValue(hash, Field::Offset());
+    hash = OGLWRAP_HashValue(hash, Field::Format::kComponents);
+    hash = OGLWRAP_HashValue(hash, Field::Format::Type());
+    hash = OGLWRAP_HashValue(hash, Field::kNormalized);
+    return Next::Hash(hash);
+  }
+
+ private:
+  // The non normalized attributes are set up like setup<Type> would do it
+  // (integers and doubles aren't converted to floats), but it works for every
+  // type that VertexAttribFormat knows, like glm::u8vec4, or GLdouble.
+  static void SetPointer(VertexAttribObject& attrib, GLsizei stride,
+                         const void *offset, std::false_type) {
+    attrib.setup(Field::Format::kComponents, DataType(Field::Format::Type()),
+                 stride, offset);
+  }
+
+  static void SetPointer(VertexAttribObject& attrib, GLsizei stride,
+                         const void *offset, std::true_type) {
+    attrib.pointer(Field::Format::kComponents,
+                   DataType(Field::Format::Type()), true, stride, offset);
+  }
+};
+
+template<typename Struct, typename Fields = typename Struct::VertexAttribs>
+/// The layout of interleaved vertices, described by a struct at compile time.
+/** Sets up the attributes of every field (see VertexFields) of the struct,
+  * with the stride of the struct, and the offsets of its members, so the
+  * strides and offsets of the attributes don't have to be computed by hand:
+  * @code
+  *   std::vector<Vertex> vertices;
+  *   gl::Bind(vao);
+  *   gl::Bind(buffer);
+  *   buffer.data(vertices);
+  *   gl::VertexLayout<Vertex>::apply();
+  * @endcode
+  * Layouts can be compared by their hashes, so the meshes that use the same
+  * layout (and buffer) can share a VAO:
+  * @code
+  *   std::unordered_map<std::uint64_t, gl::VertexArray> vaos;
+  *   gl::VertexArray& vao = vaos[gl::VertexLayout<Vertex>::Hash()];
+  * @endcode */
+class VertexLayout;
+
+template<typename Struct, typename... Fields>
+class VertexLayout<Struct, VertexFields<Fields...>> {
+  typedef OGLWRAP_VertexFieldList<Fields...> FieldList;
+
+ public:
+  enum : GLsizei {
+    /// The byte offset between consecutive vertices.
+    kStride = sizeof(Struct)
+  };
+
+  enum : size_t {
+    /// The number of vertex attributes.
+    kAttribCount = FieldList::kCount
+  };
+
+  /// Sets up and enables the attributes for the vertices stored in the
+  /// currently bound ArrayBuffer, for the currently bound VertexArray.
+  /** @param first_vertex - The byte offset of the first vertex in the
+    *                       buffer.
+    * @see glVertexAttribPointer, glVertexAttribIPointer,
+    *      glVertexAttribLPointer, glEnableVertexAttribArray */
+  static void apply(GLintptr first_vertex = 0) {
+    FieldList::Apply(kStride, static_cast<std::uintptr_t>(first_vertex));
+  }
+
+  /// Returns the hash of the layout (the stride, and the location, offset,
+  /// format and normalization of every attribute).
+  static std::uint64_t Hash() {
+    static const std::uint64_t hash = FieldList::Hash(
+        OGLWRAP_HashValue(OGLWRAP_HashInit(), kStride));
+    return hash;
+  }
+};
+#endif  // glGetAttribLocation && glVertexAttribPointer && ...
+
+}  // namespace oglwrap
+
+#endif  // OGLWRAP_VERTEX_LAYOUT_H_